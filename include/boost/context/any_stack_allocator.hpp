@@ -0,0 +1,141 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_ANY_STACK_ALLOCATOR_H
+#define BOOST_CONTEXT_ANY_STACK_ALLOCATOR_H
+
+#include <cstddef>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/sized_stack.hpp>
+#include <boost/context/fixedsize_stack.hpp>
+#include <boost/context/stack_context.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+// abstract interface of a stack allocator (cf. std::pmr::memory_resource)
+class stack_resource {
+public:
+    virtual ~stack_resource() = default;
+
+    stack_context allocate() {
+        return do_allocate();
+    }
+
+    stack_context allocate( std::size_t size) {
+        return do_allocate( size);
+    }
+
+    void deallocate( stack_context & sctx) noexcept {
+        do_deallocate( sctx);
+    }
+
+protected:
+    virtual stack_context do_allocate() = 0;
+
+    virtual stack_context do_allocate( std::size_t) = 0;
+
+    virtual void do_deallocate( stack_context &) noexcept = 0;
+};
+
+// stack_resource implemented by a stack allocator; `final` lets the
+// compiler devirtualize calls if the type of the resource is known
+template< typename StackAlloc >
+class stack_resource_adaptor final : public stack_resource {
+private:
+    StackAlloc  salloc_;
+
+public:
+    template< typename ... Args >
+    explicit stack_resource_adaptor( Args && ... args) :
+        salloc_( std::forward< Args >( args) ... ) {
+    }
+
+    StackAlloc & get_allocator() noexcept {
+        return salloc_;
+    }
+
+protected:
+    stack_context do_allocate() override final {
+        return salloc_.allocate();
+    }
+
+    stack_context do_allocate( std::size_t size) override final {
+        return detail::allocate_stack( salloc_, size);
+    }
+
+    void do_deallocate( stack_context & sctx) noexcept override final {
+        salloc_.deallocate( sctx);
+    }
+};
+
+// resource used by a default constructed any_stack_allocator
+inline
+stack_resource * default_stack_resource() noexcept {
+    static stack_resource_adaptor< fixedsize_stack > resource;
+    return & resource;
+}
+
+// type-erased stack allocator: a non-owning pointer to a stack_resource;
+// all fibers/continuations using it share one instantiation of the
+// control structure and entry functions per context-function, the
+// resource must outlive them
+class any_stack_allocator {
+private:
+    stack_resource  *   resource_;
+
+public:
+    any_stack_allocator() noexcept :
+        resource_{ default_stack_resource() } {
+    }
+
+    any_stack_allocator( stack_resource * resource) noexcept :
+        resource_{ resource } {
+        BOOST_ASSERT( nullptr != resource_);
+    }
+
+    stack_context allocate() {
+        return resource_->allocate();
+    }
+
+    stack_context allocate( std::size_t size) {
+        return resource_->allocate( size);
+    }
+
+    void deallocate( stack_context & sctx) noexcept {
+        resource_->deallocate( sctx);
+    }
+
+    stack_resource * resource() const noexcept {
+        return resource_;
+    }
+
+    bool operator==( any_stack_allocator const& other) const noexcept {
+        return resource_ == other.resource_;
+    }
+
+    bool operator!=( any_stack_allocator const& other) const noexcept {
+        return resource_ != other.resource_;
+    }
+};
+
+static_assert( sizeof( any_stack_allocator) == sizeof( void *), "any_stack_allocator must be pointer-sized");
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_ANY_STACK_ALLOCATOR_H
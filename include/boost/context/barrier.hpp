@@ -0,0 +1,72 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_BARRIER_H
+#define BOOST_CONTEXT_BARRIER_H
+
+#include <cstddef>
+#include <stdexcept>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/wait_queue.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+// reusable barrier for `initial` contexts
+class barrier {
+private:
+    detail::spinlock        splk_{};
+    detail::wait_queue      waiters_{};
+    std::size_t             initial_;
+    std::size_t             current_;
+
+public:
+    explicit barrier( std::size_t initial) :
+            initial_{ initial },
+            current_{ initial } {
+        if ( 0 == initial) {
+            throw std::invalid_argument("boost context: zero initial barrier count");
+        }
+    }
+
+    ~barrier() {
+        BOOST_ASSERT( waiters_.empty() );
+    }
+
+    barrier( barrier const&) = delete;
+    barrier & operator=( barrier const&) = delete;
+
+    // returns true for the last arriving context which resumes the
+    // waiting fibers (in arrival order, each until it suspends again)
+    bool wait() {
+        splk_.lock();
+        if ( 0 == --current_) {
+            current_ = initial_;
+            detail::wait_node * n = waiters_.pop_all();
+            splk_.unlock();
+            detail::notify_all( n);
+            return true;
+        }
+        detail::wait_node n;
+        detail::wait( waiters_, splk_, n);
+        return false;
+    }
+};
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_BARRIER_H
@@ -0,0 +1,452 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_CHANNEL_H
+#define BOOST_CONTEXT_CHANNEL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+enum class channel_op_status {
+    success = 0,
+    empty,
+    full,
+    closed
+};
+
+namespace detail {
+
+// consumer waiting for a value, lives on the stack of the consumer
+template< typename T >
+struct channel_waiter {
+    // the suspended consumer
+    fiber       f{};
+    // receives the value of a direct handoff
+    T       *   value;
+    bool        delivered{ false };
+
+    explicit channel_waiter( T * value_) noexcept :
+        value{ value_ } {
+    }
+};
+
+// bounded lock-free queue (D. Vyukov's bounded MPMC queue),
+// used with a single consumer
+template< typename T >
+class mpsc_ring {
+private:
+    typedef typename std::aligned_storage< sizeof( T), alignof( T) >::type  storage_type;
+
+    struct cell {
+        std::atomic< std::size_t >  sequence;
+        storage_type                storage;
+    };
+
+    alignas(cache_alignment) std::atomic< std::size_t >    enqueue_pos_{ 0 };
+    alignas(cache_alignment) std::atomic< std::size_t >    dequeue_pos_{ 0 };
+    cell                                                *   cells_;
+    std::size_t                                             mask_;
+
+public:
+    explicit mpsc_ring( std::size_t capacity) :
+            cells_{ nullptr },
+            mask_{ capacity - 1 } {
+        if ( 2 > capacity || 0 != ( capacity & mask_) ) {
+            throw std::invalid_argument("boost context: channel capacity must be a power of two");
+        }
+        cells_ = new cell[capacity];
+        for ( std::size_t i = 0; i < capacity; ++i) {
+            cells_[i].sequence.store( i, std::memory_order_relaxed);
+        }
+    }
+
+    ~mpsc_ring() {
+        const std::size_t end = enqueue_pos_.load( std::memory_order_relaxed);
+        for ( std::size_t pos = dequeue_pos_.load( std::memory_order_relaxed); pos != end; ++pos) {
+            reinterpret_cast< T * >( & cells_[pos & mask_].storage)->~T();
+        }
+        delete [] cells_;
+    }
+
+    mpsc_ring( mpsc_ring const&) = delete;
+    mpsc_ring & operator=( mpsc_ring const&) = delete;
+
+    // returns false if full
+    template< typename U >
+    bool try_push( U && u) {
+        // a cell once claimed must be published
+        static_assert( std::is_nothrow_constructible< T, U && >::value,
+                       "boost context: constructing the value in a cell must not throw");
+        cell * c = nullptr;
+        std::size_t pos = enqueue_pos_.load( std::memory_order_relaxed);
+        for (;;) {
+            c = & cells_[pos & mask_];
+            const std::size_t seq = c->sequence.load( std::memory_order_acquire);
+            const std::intptr_t dif = static_cast< std::intptr_t >( seq) - static_cast< std::intptr_t >( pos);
+            if ( 0 == dif) {
+                if ( enqueue_pos_.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed) ) {
+                    break;
+                }
+            } else if ( 0 > dif) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load( std::memory_order_relaxed);
+            }
+        }
+        ::new ( static_cast< void * >( & c->storage) ) T( std::forward< U >( u) );
+        c->sequence.store( pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer only; returns false if empty
+    bool try_pop( T & v) {
+        const std::size_t pos = dequeue_pos_.load( std::memory_order_relaxed);
+        cell * c = & cells_[pos & mask_];
+        if ( pos + 1 != c->sequence.load( std::memory_order_acquire) ) {
+            return false;
+        }
+        T * p = reinterpret_cast< T * >( & c->storage);
+        v = std::move( * p);
+        p->~T();
+        c->sequence.store( pos + mask_ + 1, std::memory_order_release);
+        dequeue_pos_.store( pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool empty() const noexcept {
+        return enqueue_pos_.load( std::memory_order_seq_cst) == dequeue_pos_.load( std::memory_order_seq_cst);
+    }
+};
+
+// unbounded lock-free queue (D. Vyukov's intrusive MPSC node queue)
+template< typename T >
+class mpsc_list {
+private:
+    typedef typename std::aligned_storage< sizeof( T), alignof( T) >::type  storage_type;
+
+    struct node {
+        std::atomic< node * >   next{ nullptr };
+        storage_type            storage;
+    };
+
+    // producers append at head_, the consumer removes at tail_;
+    // tail_ is a stub without value
+    alignas(cache_alignment) std::atomic< node * >     head_;
+    alignas(cache_alignment) std::atomic< node * >     tail_;
+
+public:
+    mpsc_list() {
+        node * stub = new node;
+        head_.store( stub, std::memory_order_relaxed);
+        tail_.store( stub, std::memory_order_relaxed);
+    }
+
+    ~mpsc_list() {
+        node * n = tail_.load( std::memory_order_relaxed);
+        node * next = n->next.load( std::memory_order_relaxed);
+        delete n;
+        while ( nullptr != next) {
+            n = next;
+            next = n->next.load( std::memory_order_relaxed);
+            reinterpret_cast< T * >( & n->storage)->~T();
+            delete n;
+        }
+    }
+
+    mpsc_list( mpsc_list const&) = delete;
+    mpsc_list & operator=( mpsc_list const&) = delete;
+
+    template< typename U >
+    bool try_push( U && u) {
+        node * n = new node;
+        try {
+            ::new ( static_cast< void * >( & n->storage) ) T( std::forward< U >( u) );
+        } catch (...) {
+            delete n;
+            throw;
+        }
+        node * prev = head_.exchange( n, std::memory_order_acq_rel);
+        prev->next.store( n, std::memory_order_release);
+        return true;
+    }
+
+    // consumer only; returns false if empty (or a push is not completed yet)
+    bool try_pop( T & v) {
+        node * tail = tail_.load( std::memory_order_relaxed);
+        node * next = tail->next.load( std::memory_order_acquire);
+        if ( nullptr == next) {
+            return false;
+        }
+        T * p = reinterpret_cast< T * >( & next->storage);
+        v = std::move( * p);
+        p->~T();
+        // `next` becomes the stub
+        tail_.store( next, std::memory_order_relaxed);
+        delete tail;
+        return true;
+    }
+
+    bool empty() const noexcept {
+        return head_.load( std::memory_order_seq_cst) == tail_.load( std::memory_order_seq_cst);
+    }
+};
+
+// multi-producer/single-consumer channel
+//
+// a consumer that finds the channel empty parks: it is suspended (its
+// scheduler receives an empty fiber) and its fiber is stored in the channel;
+// a producer finding the consumer parked and the queue empty switches
+// directly to the consumer, the value is moved into the consumer's variable
+// (direct handoff); otherwise the value is queued
+template< typename T, typename Queue >
+class basic_channel {
+private:
+    typedef channel_waiter< T >     waiter_type;
+
+    // waiter_ is either nullptr, a parked consumer or - tagged - a consumer
+    // about to park; a producer clears a tagged waiter to notify the consumer
+    static constexpr std::uintptr_t parking = 1;
+
+    Queue                                                   queue_;
+    alignas(cache_alignment) std::atomic< std::uintptr_t > waiter_{ 0 };
+    std::atomic< bool >                                     closed_{ false };
+
+    static std::uintptr_t tag( waiter_type * w) noexcept {
+        return reinterpret_cast< std::uintptr_t >( w);
+    }
+
+    static waiter_type * untag( std::uintptr_t w) noexcept {
+        return reinterpret_cast< waiter_type * >( w & ~ parking);
+    }
+
+    // takes the parked consumer (nullptr if none), a consumer about to park is notified
+    waiter_type * take_waiter() noexcept {
+        std::uintptr_t w = waiter_.load( std::memory_order_seq_cst);
+        while ( 0 != w) {
+            if ( waiter_.compare_exchange_weak( w, 0, std::memory_order_acq_rel) ) {
+                return 0 != ( w & parking) ? nullptr : untag( w);
+            }
+        }
+        return nullptr;
+    }
+
+    // a copy that might throw is made before a consumer or a cell of the
+    // queue is claimed, a claimed one would never be released
+    template< typename U >
+    channel_op_status push_( U && u, bool wait) {
+        typedef std::integral_constant< bool,
+            std::is_nothrow_constructible< T, U && >::value &&
+            std::is_nothrow_assignable< T &, U && >::value
+        >   nothrow_type;
+        return push_( std::forward< U >( u), wait, nothrow_type{} );
+    }
+
+    template< typename U >
+    channel_op_status push_( U && u, bool wait, std::false_type) {
+        static_assert( std::is_nothrow_move_constructible< T >::value &&
+                       std::is_nothrow_move_assignable< T >::value,
+                       "boost context: the move operations of a channel value must not throw");
+        T tmp( std::forward< U >( u) );
+        return push_( std::move( tmp), wait, std::true_type{} );
+    }
+
+    template< typename U >
+    channel_op_status push_( U && u, bool wait, std::true_type) {
+        if ( BOOST_UNLIKELY( closed_.load( std::memory_order_acquire) ) ) {
+            return channel_op_status::closed;
+        }
+        // direct handoff; only if the queue is empty, otherwise the
+        // value would overtake values queued before by this producer
+        const std::uintptr_t w = waiter_.load( std::memory_order_seq_cst);
+        if ( 0 != w && 0 == ( w & parking) && queue_.empty() ) {
+            std::uintptr_t expected = w;
+            if ( waiter_.compare_exchange_strong( expected, 0, std::memory_order_acq_rel) ) {
+                waiter_type * waiter = untag( w);
+                * waiter->value = std::forward< U >( u);
+                waiter->delivered = true;
+                resume_parked( std::move( waiter->f) );
+                return channel_op_status::success;
+            }
+        }
+        while ( ! queue_.try_push( std::forward< U >( u) ) ) {
+            if ( ! wait) {
+                return channel_op_status::full;
+            }
+            if ( BOOST_UNLIKELY( closed_.load( std::memory_order_acquire) ) ) {
+                return channel_op_status::closed;
+            }
+            // bounded queue is full
+            if ( this_fiber::has_scheduler() ) {
+                this_fiber::yield();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        // pairs with the fence of the consumer in pop()
+        std::atomic_thread_fence( std::memory_order_seq_cst);
+        wakeup();
+        return channel_op_status::success;
+    }
+
+    void wakeup() {
+        waiter_type * waiter = take_waiter();
+        if ( nullptr != waiter) {
+            resume_parked( std::move( waiter->f) );
+        }
+    }
+
+public:
+    typedef T   value_type;
+
+    template< typename ... Args >
+    explicit basic_channel( Args && ... args) :
+        queue_( std::forward< Args >( args) ... ) {
+    }
+
+    ~basic_channel() {
+        BOOST_ASSERT( 0 == waiter_.load( std::memory_order_relaxed) );
+    }
+
+    basic_channel( basic_channel const&) = delete;
+    basic_channel & operator=( basic_channel const&) = delete;
+
+    // might run a parked consumer until it parks again
+    void close() {
+        closed_.store( true, std::memory_order_seq_cst);
+        wakeup();
+    }
+
+    bool is_closed() const noexcept {
+        return closed_.load( std::memory_order_acquire);
+    }
+
+    // waits while a bounded channel is full (yields to the scheduler of the
+    // running fiber or the thread); might run a parked consumer
+    channel_op_status push( T const& v) {
+        return push_( v, true);
+    }
+
+    channel_op_status push( T && v) {
+        return push_( std::move( v), true);
+    }
+
+    channel_op_status try_push( T const& v) {
+        return push_( v, false);
+    }
+
+    channel_op_status try_push( T && v) {
+        return push_( std::move( v), false);
+    }
+
+    // consumer only; does not block
+    channel_op_status try_pop( T & v) {
+        if ( queue_.try_pop( v) ) {
+            return channel_op_status::success;
+        }
+        if ( closed_.load( std::memory_order_acquire) ) {
+            // values pushed before close()
+            return queue_.try_pop( v) ? channel_op_status::success : channel_op_status::closed;
+        }
+        return channel_op_status::empty;
+    }
+
+    // consumer only; a fiber with a registered scheduler parks while the
+    // channel is empty, other contexts yield the thread
+    channel_op_status pop( T & v) {
+        for (;;) {
+            if ( queue_.try_pop( v) ) {
+                return channel_op_status::success;
+            }
+            if ( ! this_fiber::has_scheduler() ) {
+                if ( closed_.load( std::memory_order_acquire) ) {
+                    return queue_.try_pop( v) ? channel_op_status::success : channel_op_status::closed;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            waiter_type w{ & v };
+            BOOST_ASSERT( 0 == waiter_.load( std::memory_order_relaxed) );
+            // ordered before the loads of the queue, pairs with
+            // the fence of the producers in push()
+            waiter_.store( tag( & w) | parking, std::memory_order_seq_cst);
+            if ( ! queue_.empty() || closed_.load( std::memory_order_seq_cst) ) {
+                // cleared by a producer or by `this`
+                waiter_.store( 0, std::memory_order_relaxed);
+                if ( queue_.try_pop( v) ) {
+                    return channel_op_status::success;
+                }
+                if ( closed_.load( std::memory_order_acquire) ) {
+                    return channel_op_status::closed;
+                }
+                // a push is not completed yet
+                this_fiber::yield();
+                continue;
+            }
+            this_fiber::suspend_with(
+                [this,&w]( fiber && f) -> fiber {
+                    w.f = std::move( f);
+                    std::uintptr_t expected = tag( & w) | parking;
+                    if ( waiter_.compare_exchange_strong( expected, tag( & w), std::memory_order_acq_rel) ) {
+                        // parked; `w` and `this` must not be accessed anymore,
+                        // a producer might resume the consumer already
+                        return fiber{};
+                    }
+                    // notified by a producer, the scheduler resumes the consumer
+                    return std::move( w.f);
+                });
+            if ( w.delivered) {
+                return channel_op_status::success;
+            }
+        }
+    }
+};
+
+}
+
+// bounded channel, `capacity` must be a power of two; push() waits while full
+template< typename T >
+class bounded_channel : public detail::basic_channel< T, detail::mpsc_ring< T > > {
+public:
+    explicit bounded_channel( std::size_t capacity) :
+        detail::basic_channel< T, detail::mpsc_ring< T > >{ capacity } {
+    }
+};
+
+// unbounded channel, each queued value is allocated in a node
+template< typename T >
+class unbounded_channel : public detail::basic_channel< T, detail::mpsc_list< T > > {
+public:
+    unbounded_channel() :
+        detail::basic_channel< T, detail::mpsc_list< T > >{} {
+    }
+};
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_CHANNEL_H
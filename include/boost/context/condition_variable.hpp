@@ -0,0 +1,86 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_CONDITION_VARIABLE_H
+#define BOOST_CONTEXT_CONDITION_VARIABLE_H
+
+#include <mutex>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/wait_queue.hpp>
+#include <boost/context/mutex.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+// used together with boost::context::mutex
+class condition_variable {
+private:
+    detail::spinlock        splk_{};
+    detail::wait_queue      waiters_{};
+
+public:
+    condition_variable() = default;
+
+    ~condition_variable() {
+        BOOST_ASSERT( waiters_.empty() );
+    }
+
+    condition_variable( condition_variable const&) = delete;
+    condition_variable & operator=( condition_variable const&) = delete;
+
+    // no spurious wake-ups
+    void wait( std::unique_lock< mutex > & lk) {
+        BOOST_ASSERT( lk.owns_lock() );
+        // `lk` lives on the stack of the waiting context and must not be
+        // accessed after the context is enqueued
+        mutex * mtx = lk.release();
+        mtx->disown_();
+        detail::wait_node n;
+        splk_.lock();
+        detail::wait( waiters_, splk_, n, [mtx](){ mtx->unlock_(); });
+        lk = std::unique_lock< mutex >{ * mtx };
+    }
+
+    template< typename Pred >
+    void wait( std::unique_lock< mutex > & lk, Pred pred) {
+        while ( ! pred() ) {
+            wait( lk);
+        }
+    }
+
+    // the notified fiber runs until it suspends again,
+    // typically blocking on the mutex held by the notifier
+    void notify_one() {
+        splk_.lock();
+        detail::wait_node * n = waiters_.pop_front();
+        splk_.unlock();
+        if ( nullptr != n) {
+            detail::notify( n);
+        }
+    }
+
+    void notify_all() {
+        splk_.lock();
+        detail::wait_node * n = waiters_.pop_all();
+        splk_.unlock();
+        detail::notify_all( n);
+    }
+};
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_CONDITION_VARIABLE_H
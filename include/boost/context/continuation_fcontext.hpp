@@ -33,6 +33,12 @@
 #include <boost/context/detail/disable_overload.hpp>
 #include <boost/context/detail/exception.hpp>
 #include <boost/context/detail/fcontext.hpp>
+#include <boost/context/detail/record_layout.hpp>
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+#include <boost/context/detail/sanitizer.hpp>
+#endif
+#include <boost/context/detail/shadow_stack.hpp>
+#include <boost/context/detail/sized_stack.hpp>
 #include <boost/context/detail/tuple.hpp>
 #include <boost/context/fixedsize_stack.hpp>
 #include <boost/context/flags.hpp>
@@ -44,17 +50,6 @@
 # include BOOST_ABI_PREFIX
 #endif
 
-#if defined(__CET__) && defined(__unix__)
-#  include <cet.h>
-#  include <sys/mman.h>
-#  define SHSTK_ENABLED (__CET__ & 0x2)
-#  define BOOST_CONTEXT_SHADOW_STACK (SHSTK_ENABLED && SHADOW_STACK_SYSCALL)
-#  define __NR_map_shadow_stack 451
-#ifndef SHADOW_STACK_SET_TOKEN
-#  define SHADOW_STACK_SET_TOKEN 0x1
-#endif
-#endif
-
 #if defined(BOOST_MSVC)
 # pragma warning(push)
 # pragma warning(disable: 4702)
@@ -66,6 +61,9 @@ namespace detail {
 
 inline
 transfer_t context_unwind( transfer_t t) {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( nullptr);
+#endif
     throw forced_unwind( t.fctx);
     return { nullptr, nullptr };
 }
@@ -73,11 +71,13 @@ transfer_t context_unwind( transfer_t t) {
 template< typename Rec >
 transfer_t context_exit( transfer_t t) noexcept {
     Rec * rec = static_cast< Rec * >( t.data);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( nullptr);
+    sanitizer_destroy_handoff();
+#endif
 #if BOOST_CONTEXT_SHADOW_STACK
-    // destroy shadow stack
-    std::size_t ss_size = *((unsigned long*)(reinterpret_cast< uintptr_t >( rec)- 16));
-    long unsigned int ss_base = *((unsigned long*)(reinterpret_cast< uintptr_t >( rec)- 8));
-    munmap((void *)ss_base, ss_size);
+    // recycle shadow stack
+    shadow_stack_release( rec, t.fctx);
 #endif
     // destroy context stack
     rec->deallocate();
@@ -90,15 +90,37 @@ void context_entry( transfer_t t) noexcept {
     Rec * rec = static_cast< Rec * >( t.data);
     BOOST_ASSERT( nullptr != t.fctx);
     BOOST_ASSERT( nullptr != rec);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    // fresh stack, no fake stack to restore
+    sanitizer_finish_switch( nullptr);
+    void * fake_stack = nullptr;
+#endif
     try {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        sanitizer_start_switch( & fake_stack, sanitizer_handoff() );
+#endif
         // jump back to `create_context()`
         t = jump_fcontext( t.fctx, nullptr);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        sanitizer_finish_switch( fake_stack);
+#endif
         // start executing
         t.fctx = rec->run( t.fctx);
     } catch ( forced_unwind const& ex) {
         t = { ex.fctx, nullptr };
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        sanitizer_handoff() = ex.annotation;
+#endif
     }
     BOOST_ASSERT( nullptr != t.fctx);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    // stack of `this` context will be destroyed
+    sanitizer_start_switch( nullptr, sanitizer_handoff() );
+#endif
+#if BOOST_CONTEXT_SHADOW_STACK
+    // shadow stack left empty, no return allowed
+    shadow_stack_unwind( rec);
+#endif
     // destroy context-stack of `this`context on next context
     ontop_fcontext( t.fctx, rec, context_exit< Rec >);
     BOOST_ASSERT_MSG( false, "context already terminated");
@@ -106,6 +128,9 @@ void context_entry( transfer_t t) noexcept {
 
 template< typename Ctx, typename Fn >
 transfer_t context_ontop( transfer_t t) {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( nullptr);
+#endif
     auto p = static_cast< std::tuple< Fn > * >( t.data);
     BOOST_ASSERT( nullptr != p);
     typename std::decay< Fn >::type fn = std::get< 0 >( * p);
@@ -113,6 +138,9 @@ transfer_t context_ontop( transfer_t t) {
     Ctx c{ t.fctx };
     // execute function, pass continuation via reference
     c = fn( std::move( c) );
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_handoff() = c.annotation_;
+#endif
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
     return { exchange( c.fctx_, nullptr), nullptr };
 #else
@@ -130,6 +158,9 @@ private:
     static void destroy( record * p) noexcept {
         typename std::decay< StackAlloc >::type salloc = std::move( p->salloc_);
         stack_context sctx = p->sctx_;
+#if BOOST_CONTEXT_SHADOW_STACK
+        shadow_stack_recycle( sctx, p);
+#endif
         // deallocate record
         p->~record();
         // destroy stack with stack allocator
@@ -137,11 +168,13 @@ private:
     }
 
 public:
-    record( stack_context sctx, StackAlloc && salloc,
-            Fn && fn) noexcept :
+    // instantiated with decayed types, so that lvalue and rvalue
+    // arguments share one record type
+    record( stack_context sctx, StackAlloc salloc,
+            Fn fn) noexcept :
         sctx_( sctx),
-        salloc_( std::forward< StackAlloc >( salloc)),
-        fn_( std::forward< Fn >( fn) ) {
+        salloc_( std::move( salloc)),
+        fn_( std::move( fn) ) {
     }
 
     record( record const&) = delete;
@@ -159,6 +192,9 @@ public:
 #else
         c = std::invoke( fn_, std::move( c) );
 #endif
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        sanitizer_handoff() = c.annotation_;
+#endif
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
         return exchange( c.fctx_, nullptr);
 #else
@@ -171,84 +207,65 @@ template< typename Record, typename StackAlloc, typename Fn >
 fcontext_t create_context1( StackAlloc && salloc, Fn && fn) {
     auto sctx = salloc.allocate();
     // reserve space for control structure
-	void * storage = reinterpret_cast< void * >(
-			( reinterpret_cast< uintptr_t >( sctx.sp) - static_cast< uintptr_t >( sizeof( Record) ) )
-            & ~static_cast< uintptr_t >( 0xff) );
+    // colored: the stack tops of the fibers map to different cache sets
+    void * storage = record_storage< Record >(
+            static_cast< char * >( sctx.sp) - record_color( sctx.size) );
+#if BOOST_CONTEXT_SHADOW_STACK
+    // link shadow stack with the context at stack top
+    shadow_stack_create( sctx, storage, record_stack_top( storage) );
+#endif
     // placement new for control structure on context stack
     Record * record = new ( storage) Record{
             sctx, std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) };
-    // 64byte gab between control structure and stack top
-    // should be 16byte aligned
-    void * stack_top = reinterpret_cast< void * >(
-            reinterpret_cast< uintptr_t >( storage) - static_cast< uintptr_t >( 64) );
+    void * stack_top = record_stack_top( storage);
     void * stack_bottom = reinterpret_cast< void * >(
             reinterpret_cast< uintptr_t >( sctx.sp) - static_cast< uintptr_t >( sctx.size) );
     // create fast-context
     const std::size_t size = reinterpret_cast< uintptr_t >( stack_top) - reinterpret_cast< uintptr_t >( stack_bottom);
 
-#if BOOST_CONTEXT_SHADOW_STACK
-    std::size_t ss_size = size >> 5;
-    // align shadow stack to 8 bytes.
-	ss_size = (ss_size + 7) & ~7;
-    // Todo: shadow stack occupies at least 4KB
-    ss_size = (ss_size > 4096) ? size : 4096;
-    // create shadow stack
-    void *ss_base = (void *)syscall(__NR_map_shadow_stack, 0, ss_size, SHADOW_STACK_SET_TOKEN);
-    BOOST_ASSERT(ss_base != -1);
-    unsigned long ss_sp = (unsigned long)ss_base + ss_size;
-    /* pass the shadow stack pointer to make_fcontext
-	 i.e., link the new shadow stack with the new fcontext
-	 TODO should be a better way? */
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( stack_top)- 8)) = ss_sp;
-    /* Todo: place shadow stack info in 64byte gap */
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( storage)- 8)) = (unsigned long) ss_base;
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( storage)- 16)) = ss_size;
-#endif
     const fcontext_t fctx = make_fcontext( stack_top, size, & context_entry< Record >);
     BOOST_ASSERT( nullptr != fctx);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    void * fake_stack = nullptr;
+    sanitizer_start_switch( & fake_stack, sanitizer_new_stack( stack_bottom, sctx.size) );
+#endif
     // transfer control structure to context-stack
-    return jump_fcontext( fctx, record).fctx;
+    const fcontext_t result = jump_fcontext( fctx, record).fctx;
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( fake_stack);
+#endif
+    return result;
 }
 
 template< typename Record, typename StackAlloc, typename Fn >
 fcontext_t create_context2( preallocated palloc, StackAlloc && salloc, Fn && fn) {
     // reserve space for control structure
-    void * storage = reinterpret_cast< void * >(
-            ( reinterpret_cast< uintptr_t >( palloc.sp) - static_cast< uintptr_t >( sizeof( Record) ) )
-            & ~ static_cast< uintptr_t >( 0xff) );
+    void * storage = record_storage< Record >( palloc.sp);
+#if BOOST_CONTEXT_SHADOW_STACK
+    // link shadow stack with the context at stack top
+    shadow_stack_create( palloc.sctx, storage, record_stack_top( storage) );
+#endif
     // placement new for control structure on context-stack
     Record * record = new ( storage) Record{
             palloc.sctx, std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) };
-    // 64byte gab between control structure and stack top
-    void * stack_top = reinterpret_cast< void * >(
-            reinterpret_cast< uintptr_t >( storage) - static_cast< uintptr_t >( 64) );
+    void * stack_top = record_stack_top( storage);
     void * stack_bottom = reinterpret_cast< void * >(
             reinterpret_cast< uintptr_t >( palloc.sctx.sp) - static_cast< uintptr_t >( palloc.sctx.size) );
     // create fast-context
     const std::size_t size = reinterpret_cast< uintptr_t >( stack_top) - reinterpret_cast< uintptr_t >( stack_bottom);
 
-#if BOOST_CONTEXT_SHADOW_STACK
-    std::size_t ss_size = size >> 5;
-    // align shadow stack to 8 bytes.
-	ss_size = (ss_size + 7) & ~7;
-    // Todo: shadow stack occupies at least 4KB
-    ss_size = (ss_size > 4096) ? size : 4096;
-    // create shadow stack
-    void *ss_base = (void *)syscall(__NR_map_shadow_stack, 0, ss_size, SHADOW_STACK_SET_TOKEN);
-    BOOST_ASSERT(ss_base != -1);
-    unsigned long ss_sp = (unsigned long)ss_base + ss_size;
-    /* pass the shadow stack pointer to make_fcontext
-	 i.e., link the new shadow stack with the new fcontext
-	 TODO should be a better way? */
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( stack_top)- 8)) = ss_sp;
-    /* Todo: place shadow stack info in 64byte gap */
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( storage)- 8)) = (unsigned long) ss_base;
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( storage)- 16)) = ss_size;
-#endif
     const fcontext_t fctx = make_fcontext( stack_top, size, & context_entry< Record >);
     BOOST_ASSERT( nullptr != fctx);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    void * fake_stack = nullptr;
+    sanitizer_start_switch( & fake_stack, sanitizer_new_stack( stack_bottom, palloc.sctx.size) );
+#endif
     // transfer control structure to context-stack
-    return jump_fcontext( fctx, record).fctx;
+    const fcontext_t result = jump_fcontext( fctx, record).fctx;
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( fake_stack);
+#endif
+    return result;
 }
 
 }
@@ -271,9 +288,15 @@ private:
     callcc( std::allocator_arg_t, preallocated, StackAlloc &&, Fn &&);
 
     detail::fcontext_t  fctx_{ nullptr };
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    detail::stack_annotation    annotation_{};
+#endif
 
     continuation( detail::fcontext_t fctx) noexcept :
         fctx_{ fctx } {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        annotation_ = detail::sanitizer_handoff();
+#endif
     }
 
 public:
@@ -281,6 +304,10 @@ public:
 
     ~continuation() {
         if ( BOOST_UNLIKELY( nullptr != fctx_) ) {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+            void * fake_stack = nullptr;
+            detail::sanitizer_start_switch( & fake_stack, annotation_);
+#endif
             detail::ontop_fcontext(
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
                     detail::exchange( fctx_, nullptr),
@@ -289,6 +316,9 @@ public:
 #endif
                    nullptr,
                    detail::context_unwind);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+            detail::sanitizer_finish_switch( fake_stack);
+#endif
         }
     }
 
@@ -313,13 +343,21 @@ public:
 
     continuation resume() && {
         BOOST_ASSERT( nullptr != fctx_);
-        return { detail::jump_fcontext(
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        void * fake_stack = nullptr;
+        detail::sanitizer_start_switch( & fake_stack, annotation_);
+#endif
+        const detail::transfer_t t = detail::jump_fcontext(
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
                     detail::exchange( fctx_, nullptr),
 #else
                     std::exchange( fctx_, nullptr),
 #endif
-                    nullptr).fctx };
+                    nullptr);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        detail::sanitizer_finish_switch( fake_stack);
+#endif
+        return { t.fctx };
     }
 
     template< typename Fn >
@@ -331,14 +369,22 @@ public:
     continuation resume_with( Fn && fn) && {
         BOOST_ASSERT( nullptr != fctx_);
         auto p = std::make_tuple( std::forward< Fn >( fn) );
-        return { detail::ontop_fcontext(
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        void * fake_stack = nullptr;
+        detail::sanitizer_start_switch( & fake_stack, annotation_);
+#endif
+        const detail::transfer_t t = detail::ontop_fcontext(
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
                     detail::exchange( fctx_, nullptr),
 #else
                     std::exchange( fctx_, nullptr),
 #endif
                     & p,
-                    detail::context_ontop< continuation, Fn >).fctx };
+                    detail::context_ontop< continuation, Fn >);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        detail::sanitizer_finish_switch( fake_stack);
+#endif
+        return { t.fctx };
     }
 
     explicit operator bool() const noexcept {
@@ -365,6 +411,9 @@ public:
 
     void swap( continuation & other) noexcept {
         std::swap( fctx_, other.fctx_);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        std::swap( annotation_, other.annotation_);
+#endif
     }
 };
 
@@ -382,16 +431,28 @@ callcc( Fn && fn) {
 template< typename StackAlloc, typename Fn >
 continuation
 callcc( std::allocator_arg_t, StackAlloc && salloc, Fn && fn) {
-    using Record = detail::record< continuation, StackAlloc, Fn >;
+    using Record = detail::record< continuation,
+          typename std::decay< StackAlloc >::type, typename std::decay< Fn >::type >;
     return continuation{
                 detail::create_context1< Record >(
                         std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) ) }.resume();
 }
 
+// stack of at least `size` bytes (if supported by the stack allocator)
+template< typename StackAlloc, typename Fn >
+continuation
+callcc( std::allocator_arg_t, StackAlloc && salloc, std::size_t size, Fn && fn) {
+    return callcc(
+            std::allocator_arg,
+            detail::sized_stack< typename std::decay< StackAlloc >::type >{ std::forward< StackAlloc >( salloc), size },
+            std::forward< Fn >( fn) );
+}
+
 template< typename StackAlloc, typename Fn >
 continuation
 callcc( std::allocator_arg_t, preallocated palloc, StackAlloc && salloc, Fn && fn) {
-    using Record = detail::record< continuation, StackAlloc, Fn >;
+    using Record = detail::record< continuation,
+          typename std::decay< StackAlloc >::type, typename std::decay< Fn >::type >;
     return continuation{
                 detail::create_context2< Record >(
                         palloc, std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) ) }.resume();
@@ -33,6 +33,7 @@
 #if defined(BOOST_NO_CXX17_STD_INVOKE)
 #include <boost/context/detail/invoke.hpp>
 #endif
+#include <boost/context/detail/sized_stack.hpp>
 #include <boost/context/fixedsize_stack.hpp>
 #include <boost/context/flags.hpp>
 #include <boost/context/preallocated.hpp>
@@ -447,6 +448,16 @@ callcc( std::allocator_arg_t, StackAlloc && salloc, Fn && fn) {
                 std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) ) }.resume();
 }
 
+// stack of at least `size` bytes (if supported by the stack allocator)
+template< typename StackAlloc, typename Fn >
+continuation
+callcc( std::allocator_arg_t, StackAlloc && salloc, std::size_t size, Fn && fn) {
+    return callcc(
+            std::allocator_arg,
+            detail::sized_stack< typename std::decay< StackAlloc >::type >{ std::forward< StackAlloc >( salloc), size },
+            std::forward< Fn >( fn) );
+}
+
 template< typename StackAlloc, typename Fn >
 continuation
 callcc( std::allocator_arg_t, preallocated palloc, StackAlloc && salloc, Fn && fn) {
@@ -0,0 +1,267 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_COROUTINE_H
+#define BOOST_CONTEXT_COROUTINE_H
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+
+#if ! defined(__cpp_impl_coroutine)
+# error "Boost.Context: interoperability with C++20 coroutines requires C++20 (coroutines)"
+#endif
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <boost/assert.hpp>
+
+#include <boost/context/detail/oneshot.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+// interoperability between fibers and C++20 coroutines
+//
+// this_fiber::await() - a fiber awaits an awaitable: a bridging coroutine
+// (its frame is the only allocation) awaits on behalf of the fiber, which
+// parks; the context resuming the bridging coroutine resumes the fiber
+// (see detail::resume_parked())
+// co_fiber() - a coroutine awaits a fiber: the awaiting context runs the fiber
+// until it terminates or parks; a parked fiber resumes the coroutine from its
+// stack when it terminates
+
+namespace boost {
+namespace context {
+namespace detail {
+
+template< typename A >
+decltype(auto) get_awaiter( A && a) {
+    if constexpr ( requires { std::forward< A >( a).operator co_await(); }) {
+        return std::forward< A >( a).operator co_await();
+    } else if constexpr ( requires { operator co_await( std::forward< A >( a) ); }) {
+        return operator co_await( std::forward< A >( a) );
+    } else {
+        return std::forward< A >( a);
+    }
+}
+
+template< typename A >
+using await_result_t = decltype( get_awaiter( std::declval< A >() ).await_resume() );
+
+// result of an await/a fiber, transferred between contexts
+template< typename R >
+struct result_holder {
+    std::optional< R >  value{};
+
+    template< typename Fn >
+    void set( Fn && fn) {
+        value.emplace( std::forward< Fn >( fn)() );
+    }
+
+    R get() {
+        return std::move( * value);
+    }
+};
+
+template< typename R >
+struct result_holder< R & > {
+    R   *   value{ nullptr };
+
+    template< typename Fn >
+    void set( Fn && fn) {
+        value = std::addressof( std::forward< Fn >( fn)() );
+    }
+
+    R & get() noexcept {
+        return * value;
+    }
+};
+
+template< typename R >
+struct result_holder< R && > {
+    R   *   value{ nullptr };
+
+    template< typename Fn >
+    void set( Fn && fn) {
+        R && r = std::forward< Fn >( fn)();
+        value = std::addressof( r);
+    }
+
+    R && get() noexcept {
+        return std::move( * value);
+    }
+};
+
+template<>
+struct result_holder< void > {
+    template< typename Fn >
+    void set( Fn && fn) {
+        std::forward< Fn >( fn)();
+    }
+
+    void get() noexcept {
+    }
+};
+
+// shared by an awaiting fiber and its bridging coroutine
+template< typename R >
+struct await_state {
+    result_holder< R >      result{};
+    std::exception_ptr      except{};
+    oneshot                 done{};
+};
+
+// coroutine started eagerly, its frame is destroyed when it completes
+struct bridge {
+    struct promise_type {
+        bridge get_return_object() noexcept {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept {
+            return {};
+        }
+
+        void return_void() const noexcept {
+        }
+
+        void unhandled_exception() const noexcept {
+            std::terminate();
+        }
+    };
+};
+
+template< typename A, typename R >
+bridge await_bridge( A && a, await_state< R > & s) {
+    // not std::forward(): awaits a copy of `a` (gcc-12)
+    try {
+        if constexpr ( std::is_void_v< R >) {
+            co_await static_cast< A && >( a);
+        } else {
+            // `co_await` not allowed in the lambda
+            auto && r = co_await static_cast< A && >( a);
+            s.result.set( [&r]() -> R { return std::forward< decltype( r) >( r); });
+        }
+    } catch (...) {
+        s.except = std::current_exception();
+    }
+    s.done.set();
+}
+
+}
+
+namespace this_fiber {
+
+// suspends the running fiber until `a` completes, returns the result of the
+// await; a fiber with registered scheduler parks, other contexts spin
+template< typename Awaitable >
+detail::await_result_t< Awaitable > await( Awaitable && a) {
+    using result_type = detail::await_result_t< Awaitable >;
+    detail::await_state< result_type > s;
+    // awaits on the stack of the running fiber, completes here if `a` is ready
+    detail::await_bridge( std::forward< Awaitable >( a), s);
+    s.done.wait();
+    if ( s.except) {
+        std::rethrow_exception( s.except);
+    }
+    return s.result.get();
+}
+
+}
+
+// awaitable running `fn` on a new fiber (scheduler registered) when awaited,
+// completes with the result of `fn`; awaitable once
+template< typename R, typename StackAlloc, typename Fn >
+class fiber_awaitable {
+private:
+    StackAlloc                  salloc_;
+    Fn                          fn_;
+    std::coroutine_handle<>     h_{};
+    detail::result_holder< R >  result_{};
+    std::exception_ptr          except_{};
+    std::atomic< bool >         done_{ false };
+
+public:
+    template< typename StackAlloc_, typename Fn_ >
+    fiber_awaitable( StackAlloc_ && salloc, Fn_ && fn) :
+        salloc_( std::forward< StackAlloc_ >( salloc) ),
+        fn_( std::forward< Fn_ >( fn) ) {
+    }
+
+    fiber_awaitable( fiber_awaitable const&) = delete;
+    fiber_awaitable & operator=( fiber_awaitable const&) = delete;
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    // runs the fiber until it terminates (the coroutine continues) or parks
+    // (the coroutine is suspended)
+    bool await_suspend( std::coroutine_handle<> h) {
+        h_ = h;
+        detail::resume_parked(
+            fiber{ std::allocator_arg, salloc_,
+                   [this]( fiber && sched) {
+                        this_fiber::set_scheduler( std::move( sched) );
+                        try {
+                            result_.set( fn_);
+                        } catch ( detail::forced_unwind const&) {
+                            throw;
+                        } catch (...) {
+                            except_ = std::current_exception();
+                        }
+                        if ( done_.exchange( true, std::memory_order_acq_rel) ) {
+                            // the coroutine is suspended; resumed on the stack
+                            // of this fiber, `*this` might be destroyed
+                            std::coroutine_handle<> h = h_;
+                            h.resume();
+                        }
+                        return this_fiber::release_scheduler();
+                   }});
+        return ! done_.exchange( true, std::memory_order_acq_rel);
+    }
+
+    R await_resume() {
+        if ( except_) {
+            std::rethrow_exception( except_);
+        }
+        return result_.get();
+    }
+};
+
+// a coroutine awaiting the returned awaitable runs `fn` on a fiber
+template< typename StackAlloc, typename Fn >
+fiber_awaitable< std::invoke_result_t< std::decay_t< Fn > & >, std::decay_t< StackAlloc >, std::decay_t< Fn > >
+co_fiber( std::allocator_arg_t, StackAlloc && salloc, Fn && fn) {
+    return { std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) };
+}
+
+template< typename Fn >
+fiber_awaitable< std::invoke_result_t< std::decay_t< Fn > & >, default_stack, std::decay_t< Fn > >
+co_fiber( Fn && fn) {
+    return { default_stack{}, std::forward< Fn >( fn) };
+}
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_COROUTINE_H
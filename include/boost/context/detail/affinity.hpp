@@ -0,0 +1,93 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_AFFINITY_H
+#define BOOST_CONTEXT_DETAIL_AFFINITY_H
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/opaque_tls.hpp>
+
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+#include <thread>
+#endif
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+// thread affinity of the fcontext_t based fiber (BOOST_CONTEXT_CHECK_AFFINITY)
+// a fiber pinned to a thread must not be resumed on another thread;
+// the affinity of a suspended context is carried by its fiber handle,
+// the affinity of the running context is kept per thread
+// the main context of a thread (its original stack) is pinned to the thread
+
+namespace boost {
+namespace context {
+namespace detail {
+
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+struct thread_affinity {
+    // default constructed: not pinned
+    std::thread::id     owner{};
+};
+
+struct affinity_state {
+    // affinity of the running context
+    thread_affinity     current{};
+    // affinity of the context that was handed over as raw fcontext_t
+    thread_affinity     handoff{};
+
+    affinity_state() noexcept {
+        current.owner = std::this_thread::get_id();
+    }
+
+    static affinity_state & instance() noexcept {
+        return opaque_tls< affinity_state >();
+    }
+};
+
+inline
+thread_affinity & affinity_handoff() noexcept {
+    return affinity_state::instance().handoff;
+}
+
+inline
+void affinity_check( thread_affinity const& to) noexcept {
+    BOOST_ASSERT_MSG( std::thread::id() == to.owner || std::this_thread::get_id() == to.owner,
+                      "fiber resumed on a thread other than the one it is pinned to");
+    (void)to;
+}
+
+// must be called before switching to the context described by `to`,
+// the current context is handed over to it
+inline
+void affinity_switch( thread_affinity const& to) noexcept {
+    affinity_check( to);
+    affinity_state & state = affinity_state::instance();
+    state.handoff = state.current;
+    state.current = to;
+}
+
+// must be called by a terminating context before its last switch
+// (target in handoff); the target receives no context
+inline
+void affinity_exit() noexcept {
+    affinity_state & state = affinity_state::instance();
+    affinity_check( state.handoff);
+    state.current = state.handoff;
+    state.handoff = thread_affinity{};
+}
+#endif
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_AFFINITY_H
@@ -49,6 +49,12 @@
 # define BOOST_CONTEXT_CALLDECL
 #endif
 
+// Intel CET shadow stacks; SHADOW_STACK_SYSCALL signals
+// that the kernel provides syscall map_shadow_stack
+#if defined(__CET__) && defined(__unix__)
+# define BOOST_CONTEXT_SHADOW_STACK ((__CET__ & 0x2) && SHADOW_STACK_SYSCALL)
+#endif
+
 #if defined(BOOST_USE_SEGMENTED_STACKS)
 # if ! ( (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6) ) ) || \
          (defined(__clang__) && (__clang_major__ > 2 || ( __clang_major__ == 2 && __clang_minor__ > 3) ) ) )
@@ -124,6 +130,11 @@ static constexpr std::size_t prefetch_stride{ 4 * cacheline_length };
 # include <cxxabi.h>
 #endif
 
+#if defined(BOOST_USE_ASAN) || defined(BOOST_USE_TSAN)
+// stack switches of fcontext_t are annotated for the sanitizers
+# define BOOST_CONTEXT_USE_SANITIZER
+#endif
+
 #if defined(__OpenBSD__)
 // stacks need mmap(2) with MAP_STACK
 # define BOOST_CONTEXT_USE_MAP_STACK
@@ -0,0 +1,48 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_CURRENT_FIBER_H
+#define BOOST_CONTEXT_DETAIL_CURRENT_FIBER_H
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/opaque_tls.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+// running fcontext_t based fiber of a thread (BOOST_CONTEXT_CURRENT_FIBER)
+// each context keeps its own identity in the frame that suspends it and
+// stores it in the thread local slot as soon as it is resumed
+
+namespace boost {
+namespace context {
+namespace detail {
+
+#if defined(BOOST_CONTEXT_CURRENT_FIBER)
+struct current_fiber_tag;
+
+// address of the control structure of the running fiber,
+// nullptr for the main context of the thread
+inline
+void *& current_fiber() noexcept {
+    return opaque_tls< current_fiber_tag, void * >();
+}
+
+inline
+void set_current_fiber( void * id) noexcept {
+    current_fiber() = id;
+}
+#endif
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_CURRENT_FIBER_H
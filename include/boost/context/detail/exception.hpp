@@ -11,6 +11,15 @@
 #include <boost/config.hpp>
 
 #include <boost/context/detail/fcontext.hpp>
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+#include <boost/context/detail/sanitizer.hpp>
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+#include <boost/context/detail/affinity.hpp>
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+#include <boost/context/detail/stats.hpp>
+#endif
 
 #ifdef BOOST_HAS_ABI_HEADERS
 # include BOOST_ABI_PREFIX
@@ -22,11 +31,30 @@ namespace detail {
 
 struct forced_unwind {
     fcontext_t  fctx{ nullptr };
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    stack_annotation    annotation{};
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+    thread_affinity     affinity{};
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+    stats_record    *   stats{ nullptr };
+#endif
 
     forced_unwind() = default;
 
     forced_unwind( fcontext_t fctx_) :
         fctx( fctx_) {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        // context that initiated the unwinding
+        annotation = sanitizer_handoff();
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        affinity = affinity_handoff();
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+        stats = stats_handoff();
+#endif
     }
 };
 
@@ -0,0 +1,84 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_ONESHOT_H
+#define BOOST_CONTEXT_DETAIL_ONESHOT_H
+
+#include <atomic>
+#include <thread>
+#include <utility>
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+namespace detail {
+
+// event set once, waited for by one context: a fiber with registered
+// scheduler parks, other contexts spin
+// the second of both to arrive (exchange of `done_`) resumes the parked fiber
+class oneshot {
+private:
+    fiber                   f_{};
+    std::atomic< bool >     done_{ false };
+
+public:
+    oneshot() = default;
+
+    oneshot( oneshot const&) = delete;
+    oneshot & operator=( oneshot const&) = delete;
+
+    bool ready() const noexcept {
+        return done_.load( std::memory_order_acquire);
+    }
+
+    // last access of the setting context to the event (and the state it
+    // guards): the waiting context might return immediately
+    void set() {
+        if ( done_.exchange( true, std::memory_order_acq_rel) ) {
+            // parked; runs until it parks again or terminates
+            fiber f = std::move( f_);
+            resume_parked( std::move( f) );
+        }
+    }
+
+    void wait() {
+        if ( ready() ) {
+            return;
+        }
+        if ( this_fiber::has_scheduler() ) {
+            this_fiber::suspend_with(
+                [this]( fiber && f) -> fiber {
+                    f_ = std::move( f);
+                    if ( done_.exchange( true, std::memory_order_acq_rel) ) {
+                        // set meanwhile, the scheduler resumes the fiber
+                        return std::move( f_);
+                    }
+                    // might be resumed already
+                    return fiber{};
+                });
+        } else {
+            while ( ! ready() ) {
+                std::this_thread::yield();
+            }
+        }
+    }
+};
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_ONESHOT_H
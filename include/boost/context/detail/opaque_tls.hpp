@@ -0,0 +1,45 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_OPAQUE_TLS_H
+#define BOOST_CONTEXT_DETAIL_OPAQUE_TLS_H
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+// thread local state read or written around a context switch
+// a context might be resumed by another thread, but the compiler
+// assumes that a function keeps running on one thread: it computes the
+// address of a thread local variable once, even across a call of
+// jump_fcontext(); the address is therefore taken by a function that is
+// neither inlined nor, by its side effect, deducible as const/pure (GCC)
+
+namespace boost {
+namespace context {
+namespace detail {
+
+// instance of `T` of the running thread, one per `Tag`
+template< typename Tag, typename T = Tag >
+BOOST_NOINLINE
+T & opaque_tls() noexcept {
+    thread_local static T t{};
+#if defined(__GNUC__)
+    __asm__ __volatile__ ("" ::: "memory");
+#endif
+    return t;
+}
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_OPAQUE_TLS_H
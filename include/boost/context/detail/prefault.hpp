@@ -0,0 +1,53 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_PREFAULT_H
+#define BOOST_CONTEXT_DETAIL_PREFAULT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+namespace detail {
+
+// writes one byte per page of the `bytes` (at most `size`) below `sp`, the
+// pages are resident (private copies) when the stack is handed out, the first
+// resume() of the fiber does not page-fault
+// must only be applied to unused stacks
+inline
+void prefault( void * sp, std::size_t size, std::size_t bytes, std::size_t page_size) noexcept {
+    if ( bytes > size) {
+        bytes = size;
+    }
+    if ( 0 == bytes) {
+        return;
+    }
+    volatile char * top = static_cast< char * >( sp);
+    volatile char * bottom = top - bytes;
+    // last byte of each page, the stack grows downwards
+    std::uintptr_t p = ( reinterpret_cast< std::uintptr_t >( top) - 1) & ~ static_cast< std::uintptr_t >( page_size - 1);
+    * ( top - 1) = 0;
+    while ( p > reinterpret_cast< std::uintptr_t >( bottom) ) {
+        * reinterpret_cast< volatile char * >( p - 1) = 0;
+        p -= page_size;
+    }
+}
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_PREFAULT_H
@@ -10,6 +10,7 @@
 #include <cstdint>
 
 #include <boost/config.hpp>
+#include <boost/core/ignore_unused.hpp>
 #include <boost/predef.h>
 
 #include <boost/context/detail/config.hpp>
@@ -33,37 +34,42 @@ namespace detail {
 #if BOOST_COMP_GNUC || BOOST_COMP_CLANG
 #define BOOST_HAS_PREFETCH 1
 BOOST_FORCEINLINE
-void prefetch( void * addr) {
-    // L1 cache : hint == 1
-    __builtin_prefetch( addr, 1, 1);
+void prefetch( void * addr) noexcept {
+    // L1 cache : locality == 3, prepare for write
+    __builtin_prefetch( addr, 1, 3);
 }
 #elif BOOST_COMP_INTEL || BOOST_COMP_INTEL_EMULATED
 #define BOOST_HAS_PREFETCH 1
 BOOST_FORCEINLINE
-void prefetch( void * addr) {
+void prefetch( void * addr) noexcept {
     // L1 cache : hint == _MM_HINT_T0
     _mm_prefetch( (const char *)addr, _MM_HINT_T0);
 }
 #elif BOOST_COMP_MSVC && !defined(_M_ARM) && !defined(_M_ARM64)
 #define BOOST_HAS_PREFETCH 1
 BOOST_FORCEINLINE
-void prefetch( void * addr) {
+void prefetch( void * addr) noexcept {
     // L1 cache : hint == _MM_HINT_T0
     _mm_prefetch( (const char *)addr, _MM_HINT_T0);
 }
+#else
+BOOST_FORCEINLINE
+void prefetch( void *) noexcept {
+}
 #endif
 
-inline
-void prefetch_range( void * addr, std::size_t len) {
+// prefetches all cache lines of [addr, addr + len)
+BOOST_FORCEINLINE
+void prefetch_range( void * addr, std::size_t len) noexcept {
 #if defined(BOOST_HAS_PREFETCH)
-    void * vp = addr;
-    void * end = reinterpret_cast< void * >(
-        reinterpret_cast< uintptr_t >( addr) + static_cast< uintptr_t >( len) );
-    while ( vp < end) {
-        prefetch( vp);
-        vp = reinterpret_cast< void * >(
-            reinterpret_cast< uintptr_t >( vp) + static_cast< uintptr_t >( prefetch_stride) );
+    std::uintptr_t vp = reinterpret_cast< std::uintptr_t >( addr)
+        & ~ static_cast< std::uintptr_t >( cacheline_length - 1);
+    const std::uintptr_t end = reinterpret_cast< std::uintptr_t >( addr) + static_cast< std::uintptr_t >( len);
+    for ( ; vp < end; vp += cacheline_length) {
+        prefetch( reinterpret_cast< void * >( vp) );
     }
+#else
+    boost::ignore_unused( addr, len);
 #endif
 }
 
@@ -0,0 +1,128 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_RECORD_LAYOUT_H
+#define BOOST_CONTEXT_DETAIL_RECORD_LAYOUT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+
+#if ! defined(BOOST_CONTEXT_STACK_COLORING)
+// sets of a 32KiB/8-way L1 data cache
+# define BOOST_CONTEXT_STACK_COLORING 4096
+#endif
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+// placement of the control structure (record) of a fiber/continuation at the
+// top of its stack, followed (downwards) by the context-data written by
+// make_fcontext()
+//
+// default: record 256byte aligned, 64byte gap to the context-data
+// BOOST_CONTEXT_COMPACT_RECORD: record and context-data adjacent, the record
+// is moved down so that both span as few cache lines as possible
+//
+// stacks returned by the stack allocators are page aligned: without an offset
+// the records and context-data of all fibers map to the same cache sets
+// (and alias in the 4K comparison of the x86 store buffer); the records are
+// colored - placed at an offset below the stack top, rotating over
+// BOOST_CONTEXT_STACK_COLORING bytes (0 disables)
+
+namespace boost {
+namespace context {
+namespace detail {
+
+#if defined(BOOST_CONTEXT_COMPACT_RECORD)
+// size of the context-data created by make_fcontext()
+# if defined(__x86_64__) && defined(__APPLE__)
+static constexpr std::size_t record_context_size{ 0x40 };
+# elif defined(__x86_64__) && ! defined(_WIN64)
+#  if BOOST_CONTEXT_SHADOW_STACK
+static constexpr std::size_t record_context_size{ 0x50 };
+#  else
+static constexpr std::size_t record_context_size{ 0x48 };
+#  endif
+# elif defined(__aarch64__)
+static constexpr std::size_t record_context_size{ 0xb0 };
+# else
+static constexpr std::size_t record_context_size{ 0x40 };
+# endif
+static constexpr std::size_t record_alignment{ 16 };
+# if BOOST_CONTEXT_SHADOW_STACK
+// holds the shadow_stack_link
+static constexpr std::size_t record_gap{ 32 };
+# else
+static constexpr std::size_t record_gap{ 0 };
+# endif
+#else
+static constexpr std::size_t record_alignment{ 0x100 };
+static constexpr std::size_t record_gap{ 64 };
+#endif
+
+static constexpr std::size_t record_color_span{ BOOST_CONTEXT_STACK_COLORING };
+static constexpr std::size_t record_color_stride{
+    record_alignment < cacheline_length ? cacheline_length : record_alignment };
+
+// offset of the record below the top of a stack of `size` bytes; rotates per
+// thread, at most 1/16 of the stack is spent
+inline
+std::size_t record_color( std::size_t size) noexcept {
+    const std::size_t colors = ( std::min)( record_color_span, size / 16) / record_color_stride;
+    if ( 2 > colors) {
+        return 0;
+    }
+    thread_local static std::size_t color = 0;
+    color = color + 1 < colors ? color + 1 : 0;
+    return color * record_color_stride;
+}
+
+// address of the record of type `Record` below `sp`
+template< typename Record >
+void * record_storage( void * sp) noexcept {
+    constexpr std::size_t alignment =
+        record_alignment < alignof( Record) ? alignof( Record) : record_alignment;
+    std::uintptr_t storage =
+        ( reinterpret_cast< std::uintptr_t >( sp) - static_cast< std::uintptr_t >( sizeof( Record) ) )
+        & ~ static_cast< std::uintptr_t >( alignment - 1);
+#if defined(BOOST_CONTEXT_COMPACT_RECORD)
+    // cache lines spanned by context-data, gap and record
+    auto lines = []( std::uintptr_t s) noexcept {
+        const std::uintptr_t first = ( s - record_gap - record_context_size) / cacheline_length;
+        const std::uintptr_t last = ( s + sizeof( Record) - 1) / cacheline_length;
+        return last - first;
+    };
+    std::uintptr_t best = storage;
+    for ( std::size_t i = 1; i < cacheline_length / alignment; ++i) {
+        const std::uintptr_t s = storage - i * alignment;
+        if ( lines( s) < lines( best) ) {
+            best = s;
+        }
+    }
+    storage = best;
+#endif
+    return reinterpret_cast< void * >( storage);
+}
+
+// top of the stack used by the context (start of the context-data)
+inline
+void * record_stack_top( void * storage) noexcept {
+    return reinterpret_cast< void * >(
+            reinterpret_cast< std::uintptr_t >( storage) - static_cast< std::uintptr_t >( record_gap) );
+}
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_RECORD_LAYOUT_H
@@ -0,0 +1,128 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_SANITIZER_H
+#define BOOST_CONTEXT_DETAIL_SANITIZER_H
+
+#include <cstddef>
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/externc.hpp>
+#include <boost/context/detail/opaque_tls.hpp>
+
+#if defined(BOOST_USE_TSAN)
+#include <sanitizer/tsan_interface.h>
+#endif
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+// annotations of the fcontext_t based fiber/continuation
+// the sanitizers have to be told about each stack switch;
+// ASan requires the bounds of the target stack,
+// TSan requires the fiber handle of the target
+// a suspended context is described by a `stack_annotation`
+// carried by its fiber/continuation handle
+
+namespace boost {
+namespace context {
+namespace detail {
+
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+struct stack_annotation {
+    const void  *   bottom{ nullptr };
+    std::size_t     size{ 0 };
+    void        *   tsan_fiber{ nullptr };
+};
+
+struct sanitizer_state {
+    // describes the context that was handed over as raw fcontext_t;
+    // written by finish_switch() (context switched from) and by code
+    // that consumes a fiber/continuation handle
+    stack_annotation    handoff{};
+    // true between start_switch() and finish_switch()
+    bool                pending{ false };
+
+    static sanitizer_state & instance() noexcept {
+        return opaque_tls< sanitizer_state >();
+    }
+};
+
+inline
+stack_annotation & sanitizer_handoff() noexcept {
+    return sanitizer_state::instance().handoff;
+}
+
+// must be called before the stack switch
+// `fake_stack` == nullptr signals that the current stack will be
+// destroyed and never resumed again
+// forced inline: TSan would otherwise record the entry of this function
+// on the current and its exit on the target fiber
+BOOST_FORCEINLINE
+void sanitizer_start_switch( void ** fake_stack, stack_annotation to) noexcept {
+    sanitizer_state & state = sanitizer_state::instance();
+    state.pending = true;
+#if defined(BOOST_USE_ASAN)
+    __sanitizer_start_switch_fiber( fake_stack, to.bottom, to.size);
+#else
+    (void)fake_stack;
+#endif
+#if defined(BOOST_USE_TSAN)
+    state.handoff.tsan_fiber = __tsan_get_current_fiber();
+    __tsan_switch_to_fiber( to.tsan_fiber, 0);
+#endif
+}
+
+// must be called on the new stack before any other code runs;
+// calls after the first one (ontop-function already finished
+// the switch) are no-ops
+BOOST_FORCEINLINE
+void sanitizer_finish_switch( void * fake_stack) noexcept {
+    sanitizer_state & state = sanitizer_state::instance();
+    if ( ! state.pending) {
+        return;
+    }
+    state.pending = false;
+#if defined(BOOST_USE_ASAN)
+    __sanitizer_finish_switch_fiber( fake_stack,
+                                     & state.handoff.bottom,
+                                     & state.handoff.size);
+#else
+    (void)fake_stack;
+#endif
+}
+
+// annotation of a new stack before it is entered the first time
+inline
+stack_annotation sanitizer_new_stack( void * stack_bottom, std::size_t size) noexcept {
+    stack_annotation annotation;
+    annotation.bottom = stack_bottom;
+    annotation.size = size;
+#if defined(BOOST_USE_TSAN)
+    annotation.tsan_fiber = __tsan_create_fiber( 0);
+#endif
+    return annotation;
+}
+
+// the context handed over has terminated and its stack is gone
+inline
+void sanitizer_destroy_handoff() noexcept {
+#if defined(BOOST_USE_TSAN)
+    __tsan_destroy_fiber( sanitizer_handoff().tsan_fiber);
+#endif
+    sanitizer_handoff() = stack_annotation{};
+}
+#endif
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_SANITIZER_H
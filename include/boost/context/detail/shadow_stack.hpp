@@ -0,0 +1,259 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_SHADOW_STACK_H
+#define BOOST_CONTEXT_DETAIL_SHADOW_STACK_H
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+
+#if BOOST_CONTEXT_SHADOW_STACK
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <vector>
+
+extern "C" {
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+}
+
+#include <boost/context/detail/fcontext.hpp>
+#include <boost/context/stack_context.hpp>
+#include <boost/context/stack_traits.hpp>
+
+# if !defined(__NR_map_shadow_stack)
+#  define __NR_map_shadow_stack 453
+# endif
+# if !defined(SHADOW_STACK_SET_TOKEN)
+#  define SHADOW_STACK_SET_TOKEN 0x1
+# endif
+// data stack / shadow stack; the shadow stack holds only the
+// return addresses (8 byte per call frame)
+# if !defined(BOOST_CONTEXT_SHADOW_STACK_RATIO)
+#  define BOOST_CONTEXT_SHADOW_STACK_RATIO 32
+# endif
+// recycled shadow stacks kept per thread
+# if !defined(BOOST_CONTEXT_SHADOW_STACK_POOL_SIZE)
+#  define BOOST_CONTEXT_SHADOW_STACK_POOL_SIZE 64
+# endif
+#endif
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+// a shadow stack (Intel CET) is entered via the restore token
+// at its top; the token written by map_shadow_stack() is consumed by
+// the first switch to the new context
+// a terminating context releases all entries of its shadow stack before
+// its last switch, which places a new restore token close to the top; the
+// shadow stack pointer saved by that switch locates the token, so that the
+// shadow stack can be reused without a syscall
+
+namespace boost {
+namespace context {
+namespace detail {
+
+#if BOOST_CONTEXT_SHADOW_STACK
+struct shadow_stack {
+    void        *   base{ nullptr };
+    std::size_t     size{ 0 };
+    // value of the shadow stack pointer belonging
+    // to the restore token (token at sp - 8)
+    void        *   sp{ nullptr };
+};
+
+inline
+std::size_t shadow_stack_size( std::size_t stack_size) noexcept {
+    const std::size_t page_size = stack_traits::page_size();
+    const std::size_t size =
+        ( stack_size / BOOST_CONTEXT_SHADOW_STACK_RATIO + page_size - 1) / page_size * page_size;
+    return 0 < size ? size : page_size;
+}
+
+class shadow_stack_pool {
+private:
+    std::vector< shadow_stack >     free_{};
+
+    shadow_stack_pool() = default;
+
+    static shadow_stack_pool & instance() {
+        thread_local static shadow_stack_pool pool;
+        return pool;
+    }
+
+public:
+    ~shadow_stack_pool() {
+        for ( shadow_stack & ss : free_) {
+            ::munmap( ss.base, ss.size);
+        }
+    }
+
+    shadow_stack_pool( shadow_stack_pool const&) = delete;
+    shadow_stack_pool & operator=( shadow_stack_pool const&) = delete;
+
+    // shadow stack for a data stack of `stack_size` bytes
+    static shadow_stack allocate( std::size_t stack_size) {
+        const std::size_t size = shadow_stack_size( stack_size);
+        std::vector< shadow_stack > & free = instance().free_;
+        for ( auto i = free.rbegin(); i != free.rend(); ++i) {
+            if ( i->size == size) {
+                shadow_stack ss = * i;
+                free.erase( std::next( i).base() );
+                return ss;
+            }
+        }
+        void * base = reinterpret_cast< void * >(
+                ::syscall( __NR_map_shadow_stack, 0, size, SHADOW_STACK_SET_TOKEN) );
+        if ( MAP_FAILED == base) {
+            throw std::bad_alloc();
+        }
+        shadow_stack ss;
+        ss.base = base;
+        ss.size = size;
+        // token written by the kernel
+        ss.sp = static_cast< char * >( base) + size;
+        return ss;
+    }
+
+    static void deallocate( shadow_stack const& ss) noexcept {
+        if ( nullptr == ss.base) {
+            return;
+        }
+        std::vector< shadow_stack > & free = instance().free_;
+        if ( free.size() < BOOST_CONTEXT_SHADOW_STACK_POOL_SIZE) {
+            try {
+                free.push_back( ss);
+                return;
+            } catch (...) {
+            }
+        }
+        ::munmap( ss.base, ss.size);
+    }
+};
+
+// used by the stack allocators: the shadow stack is
+// allocated and deallocated together with the stack
+inline
+void shadow_stack_allocate( stack_context & sctx) {
+    const shadow_stack ss = shadow_stack_pool::allocate( sctx.size);
+    sctx.shadow_stack = ss.base;
+    sctx.shadow_stack_size = ss.size;
+    sctx.shadow_stack_sp = ss.sp;
+}
+
+inline
+void shadow_stack_deallocate( stack_context & sctx) noexcept {
+    shadow_stack ss;
+    ss.base = sctx.shadow_stack;
+    ss.size = sctx.shadow_stack_size;
+    ss.sp = sctx.shadow_stack_sp;
+    shadow_stack_pool::deallocate( ss);
+    sctx.shadow_stack = nullptr;
+    sctx.shadow_stack_size = 0;
+    sctx.shadow_stack_sp = nullptr;
+}
+
+// shadow stack of a context, placed in the gap
+// between its control structure and stack top
+struct shadow_stack_link {
+    void        *   base;
+    std::size_t     size;
+    // shadow stack pointer belonging to the restore token, updated
+    // by the last switch of the context
+    void        *   sp;
+    // allocated from the pool because the stack allocator
+    // did not provide a shadow stack
+    bool            owned;
+};
+
+inline
+shadow_stack_link * shadow_stack_of( void * storage) noexcept {
+    return reinterpret_cast< shadow_stack_link * >(
+            static_cast< char * >( storage) - sizeof( shadow_stack_link) );
+}
+
+// links a shadow stack with the context created at `stack_top` by passing
+// its shadow stack pointer to make_fcontext()
+inline
+void shadow_stack_create( stack_context const& sctx, void * storage, void * stack_top) {
+    shadow_stack ss;
+    bool owned = false;
+    if ( nullptr != sctx.shadow_stack) {
+        ss.base = sctx.shadow_stack;
+        ss.size = sctx.shadow_stack_size;
+        ss.sp = sctx.shadow_stack_sp;
+    } else {
+        ss = shadow_stack_pool::allocate( sctx.size);
+        owned = true;
+    }
+    new ( shadow_stack_of( storage) ) shadow_stack_link{ ss.base, ss.size, ss.sp, owned };
+    * reinterpret_cast< void ** >( static_cast< char * >( stack_top) - 8) = ss.sp;
+}
+
+// pops all entries of the current shadow stack; must be called
+// by a terminating context immediately before its last switch
+// (no return is allowed afterwards)
+BOOST_FORCEINLINE
+void shadow_stack_unwind( void * storage) noexcept {
+    const shadow_stack_link * link = shadow_stack_of( storage);
+    const std::uintptr_t top = reinterpret_cast< std::uintptr_t >( link->base) + link->size;
+    // RDSSP is a NOP if shadow stacks are not enabled
+    std::uintptr_t ssp = 0;
+    __asm__ __volatile__ ("rdsspq %0" : "+r" (ssp) );
+    if ( 0 == ssp) {
+        return;
+    }
+    std::uintptr_t n = ( top - ssp) / 8;
+    while ( 0 < n) {
+        // INCSSP uses the lower 8 bits of its operand
+        std::uintptr_t k = 255 < n ? 255 : n;
+        __asm__ __volatile__ ("incsspq %0" : : "r" (k) );
+        n -= k;
+    }
+}
+
+// called on the next context after `storage`'s context terminated, `fctx`
+// is the terminated context: its first slot holds the shadow stack pointer
+// saved by the last switch (the depth of the calls between the unwinding
+// and the switch depends on the optimization level)
+inline
+void shadow_stack_release( void * storage, fcontext_t fctx) noexcept {
+    shadow_stack_link * link = shadow_stack_of( storage);
+    void * ssp = * static_cast< void ** >( fctx);
+    if ( nullptr != ssp) {
+        link->sp = ssp;
+    }
+    if ( link->owned) {
+        shadow_stack ss;
+        ss.base = link->base;
+        ss.size = link->size;
+        ss.sp = link->sp;
+        shadow_stack_pool::deallocate( ss);
+    }
+}
+
+// hands the shadow stack of the stack allocator back as left by the
+// terminated context at `storage`; called before the record is destroyed
+inline
+void shadow_stack_recycle( stack_context & sctx, void * storage) noexcept {
+    const shadow_stack_link * link = shadow_stack_of( storage);
+    if ( ! link->owned) {
+        sctx.shadow_stack_sp = link->sp;
+    }
+}
+#endif
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_SHADOW_STACK_H
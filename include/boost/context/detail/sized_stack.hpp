@@ -0,0 +1,73 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_SIZED_STACK_H
+#define BOOST_CONTEXT_DETAIL_SIZED_STACK_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/stack_context.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+namespace detail {
+
+// stack allocators modelling the extended concept provide
+// `allocate( size_hint)`, others ignore the size hint
+template< typename StackAlloc >
+auto allocate_stack( StackAlloc & salloc, std::size_t size_hint, int)
+    -> decltype( salloc.allocate( size_hint) ) {
+    return salloc.allocate( size_hint);
+}
+
+template< typename StackAlloc >
+stack_context allocate_stack( StackAlloc & salloc, std::size_t, long) {
+    return salloc.allocate();
+}
+
+template< typename StackAlloc >
+stack_context allocate_stack( StackAlloc & salloc, std::size_t size_hint) {
+    return allocate_stack( salloc, size_hint, 0);
+}
+
+// binds a size hint to a stack allocator; used by the
+// constructors of fiber and callcc() taking a stack size
+template< typename StackAlloc >
+class sized_stack {
+private:
+    StackAlloc      salloc_;
+    std::size_t     size_hint_;
+
+public:
+    sized_stack( StackAlloc salloc, std::size_t size_hint) :
+        salloc_( std::move( salloc) ),
+        size_hint_( size_hint) {
+    }
+
+    stack_context allocate() {
+        return allocate_stack( salloc_, size_hint_);
+    }
+
+    void deallocate( stack_context & sctx) noexcept {
+        salloc_.deallocate( sctx);
+    }
+};
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_SIZED_STACK_H
@@ -0,0 +1,58 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_SPINLOCK_H
+#define BOOST_CONTEXT_DETAIL_SPINLOCK_H
+
+#include <atomic>
+#include <thread>
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+namespace detail {
+
+// protects short critical sections (state of the fiber-aware primitives, stack
+// pools); never held while a context is resumed
+class spinlock {
+private:
+    std::atomic< bool >     locked_{ false };
+
+public:
+    void lock() noexcept {
+        for (;;) {
+            if ( ! locked_.exchange( true, std::memory_order_acquire) ) {
+                return;
+            }
+            while ( locked_.load( std::memory_order_relaxed) ) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool try_lock() noexcept {
+        return ! locked_.load( std::memory_order_relaxed) &&
+               ! locked_.exchange( true, std::memory_order_acquire);
+    }
+
+    void unlock() noexcept {
+        locked_.store( false, std::memory_order_release);
+    }
+};
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_SPINLOCK_H
@@ -0,0 +1,137 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_STATS_H
+#define BOOST_CONTEXT_DETAIL_STATS_H
+
+#include <cstdint>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/opaque_tls.hpp>
+
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+# if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+# elif defined(_M_X64) || defined(_M_IX86)
+#  include <intrin.h>
+# else
+#  include <chrono>
+# endif
+#endif
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+// accounting of the fcontext_t based fiber (BOOST_CONTEXT_FIBER_STATS)
+// each switch charges the elapsed ticks to the suspended context and counts
+// the resumption of the target; the record of a suspended context is carried
+// by its fiber handle, the record of the running context is kept per thread
+// ticks: time stamp counter (x86) or nanoseconds (steady_clock)
+
+namespace boost {
+namespace context {
+
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+struct fiber_stats {
+    // ticks the context was running
+    std::uint64_t   running{ 0 };
+    // ticks the context was suspended since it was created
+    std::uint64_t   suspended{ 0 };
+    // number of resumptions
+    std::uint64_t   switches{ 0 };
+};
+#endif
+
+namespace detail {
+
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+inline
+std::uint64_t stats_now() noexcept {
+# if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    return __rdtsc();
+# else
+    return static_cast< std::uint64_t >(
+            std::chrono::duration_cast< std::chrono::nanoseconds >(
+                std::chrono::steady_clock::now().time_since_epoch() ).count() );
+# endif
+}
+
+struct stats_record {
+    fiber_stats     stats{};
+    // last switch from or to the context
+    std::uint64_t   stamp{ stats_now() };
+};
+
+struct stats_state {
+    // main context of the thread
+    stats_record        main{};
+    // record of the running context
+    stats_record    *   current{ & main };
+    // record of the context that was handed over as raw fcontext_t
+    stats_record    *   handoff{ nullptr };
+
+    static stats_state & instance() noexcept {
+        return opaque_tls< stats_state >();
+    }
+};
+
+inline
+stats_record *& stats_handoff() noexcept {
+    return stats_state::instance().handoff;
+}
+
+inline
+void stats_resumed( stats_record * to, std::uint64_t now) noexcept {
+    BOOST_ASSERT( nullptr != to);
+    to->stats.suspended += now - to->stamp;
+    ++to->stats.switches;
+    to->stamp = now;
+}
+
+// must be called before switching to the context described by `to`,
+// the current context is handed over to it
+inline
+void stats_switch( stats_record * to) noexcept {
+    const std::uint64_t now = stats_now();
+    stats_state & state = stats_state::instance();
+    stats_record * from = state.current;
+    from->stats.running += now - from->stamp;
+    from->stamp = now;
+    stats_resumed( to, now);
+    state.handoff = from;
+    state.current = to;
+}
+
+// must be called by a terminating context before its last switch
+// (target in handoff); the target receives no context
+inline
+void stats_exit() noexcept {
+    stats_state & state = stats_state::instance();
+    stats_resumed( state.handoff, stats_now() );
+    state.current = state.handoff;
+    state.handoff = nullptr;
+}
+
+// statistics of the running context, including the current run
+inline
+fiber_stats stats_current() noexcept {
+    stats_record const* rec = stats_state::instance().current;
+    fiber_stats stats = rec->stats;
+    stats.running += stats_now() - rec->stamp;
+    return stats;
+}
+#endif
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_STATS_H
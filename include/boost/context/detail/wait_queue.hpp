@@ -0,0 +1,147 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_DETAIL_WAIT_QUEUE_H
+#define BOOST_CONTEXT_DETAIL_WAIT_QUEUE_H
+
+#include <atomic>
+#include <thread>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/spinlock.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_PREFIX
+#endif
+
+// building blocks of the fiber-aware synchronization primitives
+//
+// a waiting context enqueues a wait_node allocated on its own stack
+// (intrusive FIFO list, waiting never allocates); a fiber with registered
+// scheduler parks - its scheduler receives an empty fiber - other contexts
+// (threads) spin on the node
+// the notifying context resumes a parked fiber directly and runs it until it
+// parks again or terminates (see resume_parked())
+
+namespace boost {
+namespace context {
+namespace detail {
+
+struct wait_node {
+    wait_node           *   next{ nullptr };
+    // parked fiber, empty for a waiting thread
+    fiber                   f{};
+    std::atomic< bool >     notified{ false };
+};
+
+class wait_queue {
+private:
+    wait_node   *   head_{ nullptr };
+    wait_node   **  tail_{ & head_ };
+
+public:
+    wait_queue() = default;
+
+    wait_queue( wait_queue const&) = delete;
+    wait_queue & operator=( wait_queue const&) = delete;
+
+    bool empty() const noexcept {
+        return nullptr == head_;
+    }
+
+    void push_back( wait_node * n) noexcept {
+        BOOST_ASSERT( nullptr != n);
+        n->next = nullptr;
+        * tail_ = n;
+        tail_ = & n->next;
+    }
+
+    wait_node * pop_front() noexcept {
+        wait_node * n = head_;
+        if ( nullptr != n) {
+            head_ = n->next;
+            if ( nullptr == head_) {
+                tail_ = & head_;
+            }
+        }
+        return n;
+    }
+
+    // moves all nodes into a list linked by wait_node::next
+    wait_node * pop_all() noexcept {
+        wait_node * n = head_;
+        head_ = nullptr;
+        tail_ = & head_;
+        return n;
+    }
+};
+
+// enqueues `n` and waits until it is notified; `lk` (locked) is released
+// after the running context is suspended (no lost wake-up), then `fn` is
+// called - as the last access of the waiting context to shared state
+template< typename Fn >
+void wait( wait_queue & q, spinlock & lk, wait_node & n, Fn fn) {
+    if ( this_fiber::has_scheduler() ) {
+        // executed on top of the scheduler, `fn` is copied: the stack of the
+        // waiting fiber must not be accessed once `lk` is released
+        this_fiber::suspend_with(
+            [&q,&lk,&n,fn]( fiber && f) -> fiber {
+                n.f = std::move( f);
+                q.push_back( & n);
+                lk.unlock();
+                // might be notified and resumed already
+                fn();
+                return fiber{};
+            });
+    } else {
+        q.push_back( & n);
+        lk.unlock();
+        fn();
+        while ( ! n.notified.load( std::memory_order_acquire) ) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+inline
+void wait( wait_queue & q, spinlock & lk, wait_node & n) {
+    wait( q, lk, n, [](){});
+}
+
+// wakes `n`, removed from its wait queue; no spinlock must be held
+inline
+void notify( wait_node * n) {
+    BOOST_ASSERT( nullptr != n);
+    if ( n->f) {
+        // `n` is destroyed as soon as the fiber returns from wait()
+        resume_parked( std::move( n->f) );
+    } else {
+        n->notified.store( true, std::memory_order_release);
+    }
+}
+
+// wakes all nodes returned by wait_queue::pop_all()
+inline
+void notify_all( wait_node * n) {
+    while ( nullptr != n) {
+        wait_node * next = n->next;
+        notify( n);
+        n = next;
+    }
+}
+
+}}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+# include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_DETAIL_WAIT_QUEUE_H
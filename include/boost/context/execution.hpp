@@ -0,0 +1,243 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_EXECUTION_H
+#define BOOST_CONTEXT_EXECUTION_H
+
+#include <exception>
+#include <optional>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/oneshot.hpp>
+#include <boost/context/nursery.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+// senders/receivers following the member protocol of P2300 (std::execution):
+// sndr.connect( rcvr) returns an operation state, op.start() starts it,
+// the operation completes with rcvr.set_value( vs...), rcvr.set_error( e) or
+// rcvr.set_stopped(); a sender announces its completions by the member type
+// `completion_signatures`
+
+namespace boost {
+namespace context {
+namespace execution {
+
+struct sender_t {};
+struct receiver_t {};
+struct operation_state_t {};
+struct scheduler_t {};
+
+struct set_value_t {};
+struct set_error_t {};
+struct set_stopped_t {};
+
+template< typename ... Sigs >
+struct completion_signatures {};
+
+struct empty_env {};
+
+}
+
+namespace detail {
+
+// values of the (single) set_value_t completion of a sender, decayed
+template< typename ... Sigs >
+struct value_tuple {
+    // completes never with a value
+    using type = std::tuple<>;
+};
+
+template< typename ... Vs, typename ... Sigs >
+struct value_tuple< execution::set_value_t( Vs ...), Sigs ... > {
+    using type = std::tuple< std::decay_t< Vs > ... >;
+};
+
+template< typename Sig, typename ... Sigs >
+struct value_tuple< Sig, Sigs ... > : public value_tuple< Sigs ... > {
+};
+
+template< typename Sigs >
+struct sender_values;
+
+template< typename ... Sigs >
+struct sender_values< execution::completion_signatures< Sigs ... > > {
+    using type = typename value_tuple< Sigs ... >::type;
+};
+
+template< typename Sender >
+using sender_values_t = typename sender_values<
+    typename std::decay_t< Sender >::completion_signatures
+>::type;
+
+template< typename Tuple >
+struct sync_wait_state {
+    std::optional< Tuple >  value{};
+    std::exception_ptr      except{};
+    oneshot                 done{};
+};
+
+template< typename Tuple >
+class sync_wait_receiver {
+private:
+    sync_wait_state< Tuple >    *   state_;
+
+public:
+    using receiver_concept = execution::receiver_t;
+
+    explicit sync_wait_receiver( sync_wait_state< Tuple > * state) noexcept :
+        state_{ state } {
+    }
+
+    template< typename ... Vs >
+    void set_value( Vs && ... vs) noexcept {
+        try {
+            state_->value.emplace( std::forward< Vs >( vs) ... );
+        } catch (...) {
+            state_->except = std::current_exception();
+        }
+        state_->done.set();
+    }
+
+    template< typename E >
+    void set_error( E && e) noexcept {
+        if constexpr ( std::is_same_v< std::decay_t< E >, std::exception_ptr >) {
+            state_->except = std::forward< E >( e);
+        } else if constexpr ( std::is_same_v< std::decay_t< E >, std::error_code >) {
+            state_->except = std::make_exception_ptr( std::system_error{ e });
+        } else {
+            state_->except = std::make_exception_ptr( std::forward< E >( e) );
+        }
+        state_->done.set();
+    }
+
+    void set_stopped() noexcept {
+        state_->done.set();
+    }
+
+    execution::empty_env get_env() const noexcept {
+        return {};
+    }
+};
+
+}
+
+// schedule() returns a sender completing with set_value() on a new child fiber
+// of a nursery, with set_stopped() if the nursery was cancelled; the children
+// run while the nursery is joined
+class fiber_scheduler {
+private:
+    nursery     *   n_;
+
+    template< typename Receiver >
+    class operation {
+    private:
+        nursery     *   n_;
+        Receiver        r_;
+
+    public:
+        using operation_state_concept = execution::operation_state_t;
+
+        template< typename Receiver_ >
+        operation( nursery * n, Receiver_ && r) :
+            n_{ n },
+            r_( std::forward< Receiver_ >( r) ) {
+        }
+
+        operation( operation const&) = delete;
+        operation & operator=( operation const&) = delete;
+
+        void start() noexcept {
+            try {
+                n_->spawn( [this](){ std::move( r_).set_value(); },
+                           [this](){ std::move( r_).set_stopped(); });
+            } catch (...) {
+                std::move( r_).set_error( std::current_exception() );
+            }
+        }
+    };
+
+    class sender {
+    private:
+        nursery     *   n_;
+
+    public:
+        using sender_concept = execution::sender_t;
+        using completion_signatures = execution::completion_signatures<
+            execution::set_value_t(),
+            execution::set_error_t( std::exception_ptr),
+            execution::set_stopped_t()
+        >;
+
+        explicit sender( nursery * n) noexcept :
+            n_{ n } {
+        }
+
+        template< typename Receiver >
+        operation< std::decay_t< Receiver > > connect( Receiver && r) const {
+            return { n_, std::forward< Receiver >( r) };
+        }
+
+        execution::empty_env get_env() const noexcept {
+            return {};
+        }
+    };
+
+public:
+    using scheduler_concept = execution::scheduler_t;
+
+    explicit fiber_scheduler( nursery & n) noexcept :
+        n_{ & n } {
+    }
+
+    sender schedule() const noexcept {
+        return sender{ n_ };
+    }
+
+    friend bool operator==( fiber_scheduler const& l, fiber_scheduler const& r) noexcept {
+        return l.n_ == r.n_;
+    }
+
+    friend bool operator!=( fiber_scheduler const& l, fiber_scheduler const& r) noexcept {
+        return l.n_ != r.n_;
+    }
+};
+
+namespace this_fiber {
+
+// connects and starts `sndr`, suspends the running fiber until the operation
+// completes; returns the values (empty if stopped), rethrows an error
+// a fiber with registered scheduler parks, other contexts spin
+template< typename Sender >
+std::optional< detail::sender_values_t< Sender > > sync_wait( Sender && sndr) {
+    using tuple_type = detail::sender_values_t< Sender >;
+    detail::sync_wait_state< tuple_type > s;
+    auto op = std::forward< Sender >( sndr).connect( detail::sync_wait_receiver< tuple_type >{ & s });
+    op.start();
+    s.done.wait();
+    if ( s.except) {
+        std::rethrow_exception( s.except);
+    }
+    return std::move( s.value);
+}
+
+}
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_EXECUTION_H
@@ -31,9 +31,19 @@
 #if defined(BOOST_NO_CXX17_STD_INVOKE)
 #include <boost/context/detail/invoke.hpp>
 #endif
+#include <boost/context/detail/affinity.hpp>
+#include <boost/context/detail/current_fiber.hpp>
 #include <boost/context/detail/disable_overload.hpp>
 #include <boost/context/detail/exception.hpp>
 #include <boost/context/detail/fcontext.hpp>
+#include <boost/context/detail/prefetch.hpp>
+#include <boost/context/detail/record_layout.hpp>
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+#include <boost/context/detail/sanitizer.hpp>
+#endif
+#include <boost/context/detail/shadow_stack.hpp>
+#include <boost/context/detail/sized_stack.hpp>
+#include <boost/context/detail/stats.hpp>
 #include <boost/context/detail/tuple.hpp>
 #include <boost/context/fixedsize_stack.hpp>
 #include <boost/context/flags.hpp>
@@ -45,20 +55,6 @@
 # include BOOST_ABI_PREFIX
 #endif
 
-#if defined(__CET__) && defined(__unix__)
-#  include <cet.h>
-#  include <sys/mman.h>
-#  include <unistd.h>
-#  define SHSTK_ENABLED (__CET__ & 0x2)
-#  define BOOST_CONTEXT_SHADOW_STACK (SHSTK_ENABLED && SHADOW_STACK_SYSCALL)
-#  if !defined(__NR_map_shadow_stack)
-#    define __NR_map_shadow_stack 453
-#  endif
-#ifndef SHADOW_STACK_SET_TOKEN
-#  define SHADOW_STACK_SET_TOKEN 0x1
-#endif
-#endif
-
 #if defined(BOOST_MSVC)
 # pragma warning(push)
 # pragma warning(disable: 4702)
@@ -115,6 +111,9 @@ namespace detail {
 
 inline
 transfer_t fiber_unwind( transfer_t t) {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( nullptr);
+#endif
     throw forced_unwind( t.fctx);
     return { nullptr, nullptr };
 }
@@ -122,11 +121,13 @@ transfer_t fiber_unwind( transfer_t t) {
 template< typename Rec >
 transfer_t fiber_exit( transfer_t t) noexcept {
     Rec * rec = static_cast< Rec * >( t.data);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( nullptr);
+    sanitizer_destroy_handoff();
+#endif
 #if BOOST_CONTEXT_SHADOW_STACK
-    // destroy shadow stack
-    std::size_t ss_size = *((unsigned long*)(reinterpret_cast< uintptr_t >( rec)- 16));
-    long unsigned int ss_base = *((unsigned long*)(reinterpret_cast< uintptr_t >( rec)- 8));
-    munmap((void *)ss_base, ss_size);
+    // recycle shadow stack
+    shadow_stack_release( rec, t.fctx);
 #endif
     // destroy context stack
     rec->deallocate();
@@ -139,15 +140,60 @@ void fiber_entry( transfer_t t) noexcept {
     Rec * rec = static_cast< Rec * >( t.data);
     BOOST_ASSERT( nullptr != t.fctx);
     BOOST_ASSERT( nullptr != rec);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    // fresh stack, no fake stack to restore
+    sanitizer_finish_switch( nullptr);
+    void * fake_stack = nullptr;
+#endif
     try {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        sanitizer_start_switch( & fake_stack, sanitizer_handoff() );
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        // new fiber is not pinned
+        affinity_handoff() = thread_affinity{};
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+        // carried by the fiber handle of the creator
+        stats_handoff() = rec->stats();
+#endif
         // jump back to `create_context()`
         t = jump_fcontext( t.fctx, nullptr);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        sanitizer_finish_switch( fake_stack);
+#endif
+#if defined(BOOST_CONTEXT_CURRENT_FIBER)
+        set_current_fiber( rec);
+#endif
         // start executing
         t.fctx = rec->run( t.fctx);
     } catch ( forced_unwind const& ex) {
         t = { ex.fctx, nullptr };
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        sanitizer_handoff() = ex.annotation;
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        affinity_handoff() = ex.affinity;
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+        stats_handoff() = ex.stats;
+#endif
     }
     BOOST_ASSERT( nullptr != t.fctx);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    // stack of `this` context will be destroyed
+    sanitizer_start_switch( nullptr, sanitizer_handoff() );
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+    affinity_exit();
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+    stats_exit();
+#endif
+#if BOOST_CONTEXT_SHADOW_STACK
+    // shadow stack left empty, no return allowed
+    shadow_stack_unwind( rec);
+#endif
     // destroy context-stack of `this`context on next context
     ontop_fcontext( t.fctx, rec, fiber_exit< Rec >);
     BOOST_ASSERT_MSG( false, "context already terminated");
@@ -155,11 +201,23 @@ void fiber_entry( transfer_t t) noexcept {
 
 template< typename Ctx, typename Fn >
 transfer_t fiber_ontop( transfer_t t) {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( nullptr);
+#endif
     BOOST_ASSERT( nullptr != t.data);
     auto p = *static_cast< Fn * >( t.data);
     t.data = nullptr;
     // execute function, pass fiber via reference
     Ctx c = p( Ctx{ t.fctx } );
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_handoff() = c.annotation_;
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+    affinity_handoff() = c.affinity_;
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+    stats_handoff() = c.stats_;
+#endif
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
     return { exchange( c.fctx_, nullptr), nullptr };
 #else
@@ -173,10 +231,16 @@ private:
     stack_context                                       sctx_;
     typename std::decay< StackAlloc >::type             salloc_;
     typename std::decay< Fn >::type                     fn_;
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+    stats_record                                        stats_{};
+#endif
 
     static void destroy( fiber_record * p) noexcept {
         typename std::decay< StackAlloc >::type salloc = std::move( p->salloc_);
         stack_context sctx = p->sctx_;
+#if BOOST_CONTEXT_SHADOW_STACK
+        shadow_stack_recycle( sctx, p);
+#endif
         // deallocate fiber_record
         p->~fiber_record();
         // destroy stack with stack allocator
@@ -184,11 +248,13 @@ private:
     }
 
 public:
-    fiber_record( stack_context sctx, StackAlloc && salloc,
-            Fn && fn) noexcept :
+    // instantiated with decayed types, so that lvalue and rvalue
+    // arguments share one record type
+    fiber_record( stack_context sctx, StackAlloc salloc,
+            Fn fn) noexcept :
         sctx_( sctx),
-        salloc_( std::forward< StackAlloc >( salloc)),
-        fn_( std::forward< Fn >( fn) ) {
+        salloc_( std::move( salloc)),
+        fn_( std::move( fn) ) {
     }
 
     fiber_record( fiber_record const&) = delete;
@@ -198,6 +264,12 @@ public:
         destroy( this);
     }
 
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+    stats_record * stats() noexcept {
+        return & stats_;
+    }
+#endif
+
     fcontext_t run( fcontext_t fctx) {
         // invoke context-function
 #if defined(BOOST_NO_CXX17_STD_INVOKE)
@@ -205,6 +277,15 @@ public:
 #else
         Ctx c = std::invoke( fn_, Ctx{ fctx } );
 #endif
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        sanitizer_handoff() = c.annotation_;
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        affinity_handoff() = c.affinity_;
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+        stats_handoff() = c.stats_;
+#endif
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
         return exchange( c.fctx_, nullptr);
 #else
@@ -217,84 +298,65 @@ template< typename Record, typename StackAlloc, typename Fn >
 fcontext_t create_fiber1( StackAlloc && salloc, Fn && fn) {
     auto sctx = salloc.allocate();
     // reserve space for control structure
-    void * storage = reinterpret_cast< void * >(
-            ( reinterpret_cast< uintptr_t >( sctx.sp) - static_cast< uintptr_t >( sizeof( Record) ) )
-            & ~static_cast< uintptr_t >( 0xff) );
+    // colored: the stack tops of the fibers map to different cache sets
+    void * storage = record_storage< Record >(
+            static_cast< char * >( sctx.sp) - record_color( sctx.size) );
+#if BOOST_CONTEXT_SHADOW_STACK
+    // link shadow stack with the context at stack top
+    shadow_stack_create( sctx, storage, record_stack_top( storage) );
+#endif
     // placement new for control structure on context stack
     Record * record = new ( storage) Record{
             sctx, std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) };
-    // 64byte gab between control structure and stack top
-    // should be 16byte aligned
-    void * stack_top = reinterpret_cast< void * >(
-            reinterpret_cast< uintptr_t >( storage) - static_cast< uintptr_t >( 64) );
+    void * stack_top = record_stack_top( storage);
     void * stack_bottom = reinterpret_cast< void * >(
             reinterpret_cast< uintptr_t >( sctx.sp) - static_cast< uintptr_t >( sctx.size) );
     // create fast-context
     const std::size_t size = reinterpret_cast< uintptr_t >( stack_top) - reinterpret_cast< uintptr_t >( stack_bottom);
 
-#if BOOST_CONTEXT_SHADOW_STACK
-    std::size_t ss_size = size >> 5;
-    // align shadow stack to 8 bytes.
-    ss_size = (ss_size + 7) & ~7;
-    // Todo: shadow stack occupies at least 4KB
-    ss_size = (ss_size > 4096) ? size : 4096;
-    // create shadow stack
-    void *ss_base = (void *)syscall(__NR_map_shadow_stack, 0, ss_size, SHADOW_STACK_SET_TOKEN);
-    BOOST_ASSERT(ss_base != -1);
-    unsigned long ss_sp = (unsigned long)ss_base + ss_size;
-    /* pass the shadow stack pointer to make_fcontext
-       i.e., link the new shadow stack with the new fcontext
-       TODO should be a better way? */
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( stack_top)- 8)) = ss_sp;
-    /* Todo: place shadow stack info in 64byte gap */
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( storage)- 8)) = (unsigned long) ss_base;
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( storage)- 16)) = ss_size;
-#endif
     const fcontext_t fctx = make_fcontext( stack_top, size, & fiber_entry< Record >);
     BOOST_ASSERT( nullptr != fctx);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    void * fake_stack = nullptr;
+    sanitizer_start_switch( & fake_stack, sanitizer_new_stack( stack_bottom, sctx.size) );
+#endif
     // transfer control structure to context-stack
-    return jump_fcontext( fctx, record).fctx;
+    const fcontext_t result = jump_fcontext( fctx, record).fctx;
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( fake_stack);
+#endif
+    return result;
 }
 
 template< typename Record, typename StackAlloc, typename Fn >
 fcontext_t create_fiber2( preallocated palloc, StackAlloc && salloc, Fn && fn) {
     // reserve space for control structure
-    void * storage = reinterpret_cast< void * >(
-            ( reinterpret_cast< uintptr_t >( palloc.sp) - static_cast< uintptr_t >( sizeof( Record) ) )
-            & ~ static_cast< uintptr_t >( 0xff) );
+    void * storage = record_storage< Record >( palloc.sp);
+#if BOOST_CONTEXT_SHADOW_STACK
+    // link shadow stack with the context at stack top
+    shadow_stack_create( palloc.sctx, storage, record_stack_top( storage) );
+#endif
     // placwment new for control structure on context-stack
     Record * record = new ( storage) Record{
             palloc.sctx, std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) };
-    // 64byte gab between control structure and stack top
-    void * stack_top = reinterpret_cast< void * >(
-            reinterpret_cast< uintptr_t >( storage) - static_cast< uintptr_t >( 64) );
+    void * stack_top = record_stack_top( storage);
     void * stack_bottom = reinterpret_cast< void * >(
             reinterpret_cast< uintptr_t >( palloc.sctx.sp) - static_cast< uintptr_t >( palloc.sctx.size) );
     // create fast-context
     const std::size_t size = reinterpret_cast< uintptr_t >( stack_top) - reinterpret_cast< uintptr_t >( stack_bottom);
 
-#if BOOST_CONTEXT_SHADOW_STACK
-    std::size_t ss_size = size >> 5;
-    // align shadow stack to 8 bytes.
-    ss_size = (ss_size + 7) & ~7;
-    // Todo: shadow stack occupies at least 4KB
-    ss_size = (ss_size > 4096) ? size : 4096;
-    // create shadow stack
-    void *ss_base = (void *)syscall(__NR_map_shadow_stack, 0, ss_size, SHADOW_STACK_SET_TOKEN);
-    BOOST_ASSERT(ss_base != -1);
-    unsigned long ss_sp = (unsigned long)ss_base + ss_size;
-    /* pass the shadow stack pointer to make_fcontext
-       i.e., link the new shadow stack with the new fcontext
-       TODO should be a better way? */
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( stack_top)- 8)) = ss_sp;
-    /* Todo: place shadow stack info in 64byte gap */
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( storage)- 8)) = (unsigned long) ss_base;
-    *((unsigned long*)(reinterpret_cast< uintptr_t >( storage)- 16)) = ss_size;
-#endif
     const fcontext_t fctx = make_fcontext( stack_top, size, & fiber_entry< Record >);
     BOOST_ASSERT( nullptr != fctx);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    void * fake_stack = nullptr;
+    sanitizer_start_switch( & fake_stack, sanitizer_new_stack( stack_bottom, palloc.sctx.size) );
+#endif
     // transfer control structure to context-stack
-    return jump_fcontext( fctx, record).fctx;
+    const fcontext_t result = jump_fcontext( fctx, record).fctx;
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    sanitizer_finish_switch( fake_stack);
+#endif
+    return result;
 }
 
 } // namespace detail
@@ -308,10 +370,31 @@ private:
     friend detail::transfer_t
     detail::fiber_ontop( detail::transfer_t);
 
+    // copies the stack of a suspended fiber, starting at `fctx_`
+    friend class shared_fiber;
+
     detail::fcontext_t  fctx_{ nullptr };
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+    detail::stack_annotation    annotation_{};
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+    detail::thread_affinity     affinity_{};
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+    detail::stats_record    *   stats_{ nullptr };
+#endif
 
     fiber( detail::fcontext_t fctx) noexcept :
         fctx_{ fctx } {
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        annotation_ = detail::sanitizer_handoff();
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        affinity_ = detail::affinity_handoff();
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+        stats_ = detail::stats_handoff();
+#endif
     }
 
 public:
@@ -324,13 +407,23 @@ public:
 
     template< typename StackAlloc, typename Fn >
     fiber( std::allocator_arg_t, StackAlloc && salloc, Fn && fn) :
-        fctx_{ detail::create_fiber1< detail::fiber_record< fiber, StackAlloc, Fn > >(
+        fiber{ detail::create_fiber1< detail::fiber_record< fiber,
+                    typename std::decay< StackAlloc >::type, typename std::decay< Fn >::type > >(
                 std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) ) } {
     }
 
+    // stack of at least `size` bytes (if supported by the stack allocator)
+    template< typename StackAlloc, typename Fn >
+    fiber( std::allocator_arg_t, StackAlloc && salloc, std::size_t size, Fn && fn) :
+        fiber{ std::allocator_arg,
+               detail::sized_stack< typename std::decay< StackAlloc >::type >{ std::forward< StackAlloc >( salloc), size },
+               std::forward< Fn >( fn) } {
+    }
+
     template< typename StackAlloc, typename Fn >
     fiber( std::allocator_arg_t, preallocated palloc, StackAlloc && salloc, Fn && fn) :
-        fctx_{ detail::create_fiber2< detail::fiber_record< fiber, StackAlloc, Fn > >(
+        fiber{ detail::create_fiber2< detail::fiber_record< fiber,
+                    typename std::decay< StackAlloc >::type, typename std::decay< Fn >::type > >(
                 palloc, std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) ) } {
     }
 
@@ -346,6 +439,19 @@ public:
         if ( BOOST_UNLIKELY( nullptr != fctx_) ) {
             detail::manage_exception_state exstate;
             boost::ignore_unused(exstate);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+            void * fake_stack = nullptr;
+            detail::sanitizer_start_switch( & fake_stack, annotation_);
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+            detail::affinity_switch( affinity_);
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+            detail::stats_switch( stats_);
+#endif
+#if defined(BOOST_CONTEXT_CURRENT_FIBER)
+            void * self = detail::current_fiber();
+#endif
             detail::ontop_fcontext(
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
                     detail::exchange( fctx_, nullptr),
@@ -354,6 +460,12 @@ public:
 #endif
                    nullptr,
                    detail::fiber_unwind);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+            detail::sanitizer_finish_switch( fake_stack);
+#endif
+#if defined(BOOST_CONTEXT_CURRENT_FIBER)
+            detail::set_current_fiber( self);
+#endif
         }
     }
 
@@ -376,13 +488,33 @@ public:
         BOOST_ASSERT( nullptr != fctx_);
         detail::manage_exception_state exstate;
         boost::ignore_unused(exstate);
-        return { detail::jump_fcontext(
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        void * fake_stack = nullptr;
+        detail::sanitizer_start_switch( & fake_stack, annotation_);
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        detail::affinity_switch( affinity_);
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+        detail::stats_switch( stats_);
+#endif
+#if defined(BOOST_CONTEXT_CURRENT_FIBER)
+        void * self = detail::current_fiber();
+#endif
+        const detail::transfer_t t = detail::jump_fcontext(
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
                     detail::exchange( fctx_, nullptr),
 #else
                     std::exchange( fctx_, nullptr),
 #endif
-                    nullptr).fctx };
+                    nullptr);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        detail::sanitizer_finish_switch( fake_stack);
+#endif
+#if defined(BOOST_CONTEXT_CURRENT_FIBER)
+        detail::set_current_fiber( self);
+#endif
+        return { t.fctx };
     }
 
     template< typename Fn >
@@ -391,16 +523,78 @@ public:
         detail::manage_exception_state exstate;
         boost::ignore_unused(exstate);
         auto p = std::forward< Fn >( fn);
-        return { detail::ontop_fcontext(
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        void * fake_stack = nullptr;
+        detail::sanitizer_start_switch( & fake_stack, annotation_);
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        detail::affinity_switch( affinity_);
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+        detail::stats_switch( stats_);
+#endif
+#if defined(BOOST_CONTEXT_CURRENT_FIBER)
+        void * self = detail::current_fiber();
+#endif
+        const detail::transfer_t t = detail::ontop_fcontext(
 #if defined(BOOST_NO_CXX14_STD_EXCHANGE)
                     detail::exchange( fctx_, nullptr),
 #else
                     std::exchange( fctx_, nullptr),
 #endif
                     & p,
-                    detail::fiber_ontop< fiber, decltype(p) >).fctx };
+                    detail::fiber_ontop< fiber, decltype(p) >);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        detail::sanitizer_finish_switch( fake_stack);
+#endif
+#if defined(BOOST_CONTEXT_CURRENT_FIBER)
+        detail::set_current_fiber( self);
+#endif
+        return { t.fctx };
+    }
+
+    // hint for schedulers: loads the saved context-data and the top-most
+    // frames of the suspended fiber into the cache ahead of resume()
+    void prefetch() const noexcept {
+        BOOST_ASSERT( nullptr != fctx_);
+        detail::prefetch_range( fctx_, prefetch_stride);
+    }
+
+    // binds the suspended fiber to the calling thread; with
+    // BOOST_CONTEXT_CHECK_AFFINITY resuming it on another thread asserts
+    void pin() noexcept {
+        BOOST_ASSERT( nullptr != fctx_);
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        affinity_.owner = std::this_thread::get_id();
+#endif
+    }
+
+    void unpin() noexcept {
+        BOOST_ASSERT( nullptr != fctx_);
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        affinity_.owner = std::thread::id();
+#endif
     }
 
+    // hands the suspended fiber over to another thread;
+    // a pinned fiber must not be migrated
+    fiber migrate() && noexcept {
+        BOOST_ASSERT( nullptr != fctx_);
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        BOOST_ASSERT_MSG( std::thread::id() == affinity_.owner,
+                          "pinned fiber must not be migrated");
+#endif
+        return std::move( * this);
+    }
+
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+    // running/suspended ticks and resumptions of the suspended fiber
+    fiber_stats stats() const noexcept {
+        BOOST_ASSERT( nullptr != fctx_);
+        return stats_->stats;
+    }
+#endif
+
     explicit operator bool() const noexcept {
         return nullptr != fctx_;
     }
@@ -435,6 +629,15 @@ public:
 
     void swap( fiber & other) noexcept {
         std::swap( fctx_, other.fctx_);
+#if defined(BOOST_CONTEXT_USE_SANITIZER)
+        std::swap( annotation_, other.annotation_);
+#endif
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY)
+        std::swap( affinity_, other.affinity_);
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+        std::swap( stats_, other.stats_);
+#endif
     }
 };
 
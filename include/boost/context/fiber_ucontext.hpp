@@ -43,6 +43,8 @@ extern "C" {
 #if defined(BOOST_NO_CXX17_STD_INVOKE)
 #include <boost/context/detail/invoke.hpp>
 #endif
+#include <boost/context/detail/prefetch.hpp>
+#include <boost/context/detail/sized_stack.hpp>
 #include <boost/context/fixedsize_stack.hpp>
 #include <boost/context/flags.hpp>
 #include <boost/context/preallocated.hpp>
@@ -448,6 +450,14 @@ public:
                 std::forward< StackAlloc >( salloc), std::forward< Fn >( fn) ) } {
     }
 
+    // stack of at least `size` bytes (if supported by the stack allocator)
+    template< typename StackAlloc, typename Fn >
+    fiber( std::allocator_arg_t, StackAlloc && salloc, std::size_t size, Fn && fn) :
+        fiber{ std::allocator_arg,
+               detail::sized_stack< typename std::decay< StackAlloc >::type >{ std::forward< StackAlloc >( salloc), size },
+               std::forward< Fn >( fn) } {
+    }
+
     template< typename StackAlloc, typename Fn >
     fiber( std::allocator_arg_t, preallocated palloc, StackAlloc && salloc, Fn && fn) :
         ptr_{ detail::create_fiber2< fiber >(
@@ -515,6 +525,28 @@ public:
         return { ptr };
     }
 
+    // hint for schedulers: loads the control structure (saved registers)
+    // of the suspended fiber into the cache ahead of resume()
+    void prefetch() const noexcept {
+        BOOST_ASSERT( nullptr != ptr_);
+        detail::prefetch_range( ptr_, prefetch_stride);
+    }
+
+    // thread affinity is checked only by the fcontext_t based implementation
+    void pin() noexcept {
+        BOOST_ASSERT( nullptr != ptr_);
+    }
+
+    void unpin() noexcept {
+        BOOST_ASSERT( nullptr != ptr_);
+    }
+
+    // hands the suspended fiber over to another thread
+    fiber migrate() && noexcept {
+        BOOST_ASSERT( nullptr != ptr_);
+        return std::move( * this);
+    }
+
     explicit operator bool() const noexcept {
         return nullptr != ptr_ && ! ptr_->terminated;
     }
@@ -15,6 +15,8 @@
 #include <boost/config.hpp>
 
 #include <boost/context/detail/config.hpp>
+#include <boost/context/detail/prefault.hpp>
+#include <boost/context/detail/shadow_stack.hpp>
 #include <boost/context/stack_context.hpp>
 #include <boost/context/stack_traits.hpp>
 
@@ -39,31 +41,44 @@ template< typename traitsT >
 class basic_fixedsize_stack {
 private:
     std::size_t     size_;
+    std::size_t     prefault_;
 
 public:
     typedef traitsT traits_type;
 
-    basic_fixedsize_stack( std::size_t size = traits_type::default_size() ) BOOST_NOEXCEPT_OR_NOTHROW :
-        size_( size) {
+    // the top `prefault` bytes of each stack are resident when it is returned
+    basic_fixedsize_stack( std::size_t size = traits_type::default_size(),
+                           std::size_t prefault = 0) BOOST_NOEXCEPT_OR_NOTHROW :
+        size_( size),
+        prefault_( prefault) {
     }
 
     stack_context allocate() {
+        return allocate( size_);
+    }
+
+    // stack of at least `size` bytes, sctx.size is the granted size
+    stack_context allocate( std::size_t size) {
 #if defined(BOOST_CONTEXT_USE_MAP_STACK)
-        void * vp = ::mmap( 0, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_STACK, -1, 0);
+        void * vp = ::mmap( 0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_STACK, -1, 0);
         if ( vp == MAP_FAILED) {
             throw std::bad_alloc();
         }
 #else
-        void * vp = std::malloc( size_);
+        void * vp = std::malloc( size);
         if ( ! vp) {
             throw std::bad_alloc();
         }
 #endif
         stack_context sctx;
-        sctx.size = size_;
+        sctx.size = size;
         sctx.sp = static_cast< char * >( vp) + sctx.size;
+        detail::prefault( sctx.sp, sctx.size, prefault_, traits_type::page_size() );
 #if defined(BOOST_USE_VALGRIND)
         sctx.valgrind_stack_id = VALGRIND_STACK_REGISTER( sctx.sp, vp);
+#endif
+#if BOOST_CONTEXT_SHADOW_STACK
+        detail::shadow_stack_allocate( sctx);
 #endif
         return sctx;
     }
@@ -73,6 +88,9 @@ public:
 
 #if defined(BOOST_USE_VALGRIND)
         VALGRIND_STACK_DEREGISTER( sctx.valgrind_stack_id);
+#endif
+#if BOOST_CONTEXT_SHADOW_STACK
+        detail::shadow_stack_deallocate( sctx);
 #endif
         void * vp = static_cast< char * >( sctx.sp) - sctx.size;
 #if defined(BOOST_CONTEXT_USE_MAP_STACK)
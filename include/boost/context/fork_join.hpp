@@ -0,0 +1,350 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_FORK_JOIN_H
+#define BOOST_CONTEXT_FORK_JOIN_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/opaque_tls.hpp>
+#include <boost/context/detail/spinlock.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+class fork_join_pool;
+
+namespace detail {
+
+// worker thread of a fork_join_pool: deque of stealable continuations, the
+// owner pushes and pops at the back, thieves steal from the front (oldest)
+class fork_join_worker {
+private:
+    spinlock                    splk_{};
+    std::deque< fiber >         deque_{};
+
+public:
+    fork_join_pool          *   pool;
+    // scheduling loop of the thread, suspended while fibers run
+    fiber                       loop{};
+
+    explicit fork_join_worker( fork_join_pool * p) noexcept :
+        pool{ p } {
+    }
+
+    void push( fiber && f) {
+        splk_.lock();
+        deque_.push_back( std::move( f) );
+        splk_.unlock();
+    }
+
+    fiber pop() noexcept {
+        fiber f;
+        splk_.lock();
+        if ( ! deque_.empty() ) {
+            f = std::move( deque_.back() );
+            deque_.pop_back();
+        }
+        splk_.unlock();
+        return f;
+    }
+
+    fiber steal() noexcept {
+        fiber f;
+        if ( ! splk_.try_lock() ) {
+            return f;
+        }
+        if ( ! deque_.empty() ) {
+            f = std::move( deque_.front() );
+            deque_.pop_front();
+        }
+        splk_.unlock();
+        return f ? std::move( f).migrate() : fiber{};
+    }
+
+    // context to switch to if the running fiber terminates or waits:
+    // the youngest continuation of this worker, else the loop
+    fiber next() noexcept {
+        fiber f = pop();
+        return f ? std::move( f) : std::move( loop);
+    }
+};
+
+// worker of the running thread
+inline
+fork_join_worker *& current_worker() noexcept {
+    return opaque_tls< fork_join_worker * >();
+}
+
+// a suspended fiber is resumed by another fiber (receives nothing) or by the
+// loop of a worker (receives the loop)
+inline
+void fork_join_resumed( fiber && f) noexcept {
+    if ( f) {
+        current_worker()->loop = std::move( f);
+    }
+}
+
+}
+
+// worker threads running fibers that fork and join (fork_join); the
+// continuation of a forking fiber is stolen by idle workers
+class fork_join_pool {
+private:
+    friend class fork_join;
+
+    pooled_fixedsize_stack                                      salloc_;
+    std::vector< std::unique_ptr< detail::fork_join_worker > >  workers_{};
+    std::vector< std::thread >                                  threads_{};
+    std::atomic< bool >                                         stop_{ false };
+
+    fiber steal_( std::size_t self, std::size_t & victim) noexcept {
+        const std::size_t n = workers_.size();
+        for ( std::size_t i = 0; i < n; ++i) {
+            victim = ( victim + 1) % n;
+            if ( self != victim) {
+                fiber f = workers_[victim]->steal();
+                if ( f) {
+                    return f;
+                }
+            }
+        }
+        return fiber{};
+    }
+
+    void loop_( std::size_t self) {
+        detail::fork_join_worker * w = workers_[self].get();
+        detail::current_worker() = w;
+        std::size_t victim = self;
+        std::size_t idle = 0;
+        while ( ! stop_.load( std::memory_order_relaxed) ) {
+            fiber f = w->pop();
+            if ( ! f) {
+                f = steal_( self, victim);
+            }
+            if ( ! f) {
+                // spins, sleeps if idle for longer
+                if ( 1024 > ++idle) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for( std::chrono::microseconds{ 100 });
+                }
+                continue;
+            }
+            idle = 0;
+            // a fiber syncing switches back with the fiber to resume next
+            do {
+                f = std::move( f).resume();
+            } while ( f);
+        }
+        detail::current_worker() = nullptr;
+    }
+
+public:
+    explicit fork_join_pool( std::size_t workers = std::thread::hardware_concurrency(),
+                             pooled_fixedsize_stack salloc = pooled_fixedsize_stack{}) :
+        salloc_( std::move( salloc) ) {
+        if ( 0 == workers) {
+            workers = 1;
+        }
+        for ( std::size_t i = 0; i < workers; ++i) {
+            workers_.emplace_back( new detail::fork_join_worker{ this });
+        }
+        try {
+            for ( std::size_t i = 0; i < workers; ++i) {
+                threads_.emplace_back( [this,i](){ loop_( i); });
+            }
+        } catch (...) {
+            stop_.store( true, std::memory_order_relaxed);
+            for ( std::thread & t : threads_) {
+                t.join();
+            }
+            throw;
+        }
+    }
+
+    // no fiber must run
+    ~fork_join_pool() {
+        stop_.store( true, std::memory_order_relaxed);
+        for ( std::thread & t : threads_) {
+            t.join();
+        }
+    }
+
+    fork_join_pool( fork_join_pool const&) = delete;
+    fork_join_pool & operator=( fork_join_pool const&) = delete;
+
+    std::size_t size() const noexcept {
+        return workers_.size();
+    }
+
+    // runs `fn` on a fiber of the pool, blocks the calling thread (not a
+    // worker) until it returned; rethrows its exception
+    template< typename Fn >
+    void run( Fn fn) {
+        BOOST_ASSERT( nullptr == detail::current_worker() );
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool done = false;
+        std::exception_ptr except;
+        fiber root{ std::allocator_arg, salloc_,
+            [&mtx,&cv,&done,&except,fn]( fiber && loop) mutable -> fiber {
+                // empty if resumed by a terminating fiber
+                detail::fork_join_resumed( std::move( loop) );
+                try {
+                    fn();
+                } catch ( detail::forced_unwind const&) {
+                    throw;
+                } catch (...) {
+                    except = std::current_exception();
+                }
+                // might run on another worker now
+                detail::fork_join_worker * w = detail::current_worker();
+                {
+                    std::unique_lock< std::mutex > lk{ mtx };
+                    done = true;
+                    cv.notify_one();
+                }
+                return w->next();
+            }};
+        workers_.front()->push( std::move( root) );
+        std::unique_lock< std::mutex > lk{ mtx };
+        cv.wait( lk, [&done](){ return done; });
+        if ( except) {
+            std::rethrow_exception( except);
+        }
+    }
+};
+
+// scope of the children forked by a fiber of a fork_join_pool (work-first):
+// spawn() runs the child at once on the current worker, the continuation of
+// the forking fiber is stealable meanwhile; sync() waits for the children
+// the first exception thrown by a child is rethrown by sync()
+class fork_join {
+private:
+    // children + 1 (the forking fiber, until it waits in sync())
+    std::atomic< std::size_t >  pending_{ 1 };
+    // forking fiber waiting in sync()
+    fiber                       waiter_{};
+    detail::spinlock            splk_{};
+    std::exception_ptr          except_{};
+
+    void fail_( std::exception_ptr except) noexcept {
+        splk_.lock();
+        if ( ! except_) {
+            except_ = std::move( except);
+        }
+        splk_.unlock();
+    }
+
+    // last access of a child to the scope
+    fiber done_() noexcept {
+        if ( 1 == pending_.fetch_sub( 1, std::memory_order_acq_rel) ) {
+            // last child, the forking fiber waits in sync()
+            return std::move( waiter_);
+        }
+        return detail::current_worker()->next();
+    }
+
+    void wait_() {
+        if ( 1 == pending_.load( std::memory_order_acquire) ) {
+            return;
+        }
+        fiber f = std::move( detail::current_worker()->loop).resume_with(
+            [this]( fiber && waiter) -> fiber {
+                // the forking fiber is suspended
+                waiter_ = std::move( waiter);
+                if ( 1 == pending_.fetch_sub( 1, std::memory_order_acq_rel) ) {
+                    // the children completed meanwhile, resumed by the loop
+                    return std::move( waiter_);
+                }
+                return fiber{};
+            });
+        detail::fork_join_resumed( std::move( f) );
+        pending_.store( 1, std::memory_order_relaxed);
+    }
+
+public:
+    // must be constructed by a fiber of a fork_join_pool
+    fork_join() noexcept {
+        BOOST_ASSERT( nullptr != detail::current_worker() );
+    }
+
+    // waits for the children, their exceptions are dropped
+    ~fork_join() {
+        wait_();
+    }
+
+    fork_join( fork_join const&) = delete;
+    fork_join & operator=( fork_join const&) = delete;
+
+    // runs `fn` on a new fiber, the calling fiber might continue on another
+    // worker (stolen) or after `fn` returned
+    template< typename Fn >
+    void spawn( Fn fn) {
+        detail::fork_join_worker * w = detail::current_worker();
+        pending_.fetch_add( 1, std::memory_order_relaxed);
+        fiber child;
+        try {
+            child = fiber{ std::allocator_arg, w->pool->salloc_,
+                [this,fn]( fiber && parent) mutable -> fiber {
+                    // the continuation of the forking fiber becomes stealable
+                    detail::current_worker()->push( std::move( parent) );
+                    try {
+                        fn();
+                    } catch ( detail::forced_unwind const&) {
+                        throw;
+                    } catch (...) {
+                        fail_( std::current_exception() );
+                    }
+                    // might run on another worker now
+                    return done_();
+                }};
+        } catch (...) {
+            pending_.fetch_sub( 1, std::memory_order_relaxed);
+            throw;
+        }
+        fiber f = std::move( child).resume();
+        detail::fork_join_resumed( std::move( f) );
+    }
+
+    // waits until the children terminated; rethrows the first exception
+    void sync() {
+        wait_();
+        if ( except_) {
+            std::exception_ptr except;
+            std::swap( except, except_);
+            std::rethrow_exception( except);
+        }
+    }
+};
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_FORK_JOIN_H
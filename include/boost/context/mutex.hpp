@@ -0,0 +1,123 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_MUTEX_H
+#define BOOST_CONTEXT_MUTEX_H
+
+#include <atomic>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/wait_queue.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+// suspends a fiber (with registered scheduler) instead of blocking the thread;
+// the ownership is handed over to the first waiter by unlock()
+class mutex {
+private:
+    detail::spinlock        splk_{};
+    detail::wait_queue      waiters_{};
+    bool                    locked_{ false };
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+    // checks only, written by the owner
+    std::atomic< void const* >  owner_{ nullptr };
+#endif
+
+    friend class condition_variable;
+
+    void set_owner() noexcept {
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+        owner_.store( this_fiber::get_id(), std::memory_order_relaxed);
+#endif
+    }
+
+    void disown_() noexcept {
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+        BOOST_ASSERT_MSG( this_fiber::get_id() == owner_.load( std::memory_order_relaxed),
+                          "mutex not owned by the running context");
+        owner_.store( nullptr, std::memory_order_relaxed);
+#endif
+    }
+
+    // might be called by a context other than the owner
+    // (condition_variable::wait() unlocks on top of the scheduler)
+    void unlock_() {
+        splk_.lock();
+        BOOST_ASSERT( locked_);
+        detail::wait_node * n = waiters_.pop_front();
+        if ( nullptr == n) {
+            locked_ = false;
+            splk_.unlock();
+            return;
+        }
+        splk_.unlock();
+        // `locked_` remains set, `n` is the new owner
+        detail::notify( n);
+    }
+
+public:
+    mutex() = default;
+
+    ~mutex() {
+        BOOST_ASSERT( ! locked_);
+        BOOST_ASSERT( waiters_.empty() );
+    }
+
+    mutex( mutex const&) = delete;
+    mutex & operator=( mutex const&) = delete;
+
+    void lock() {
+        splk_.lock();
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+        BOOST_ASSERT_MSG( ! locked_ || this_fiber::get_id() != owner_.load( std::memory_order_relaxed),
+                          "deadlock: mutex already owned by the running context");
+#endif
+        if ( ! locked_) {
+            locked_ = true;
+            splk_.unlock();
+            set_owner();
+            return;
+        }
+        detail::wait_node n;
+        detail::wait( waiters_, splk_, n);
+        // ownership handed over by unlock()
+        set_owner();
+    }
+
+    bool try_lock() noexcept {
+        splk_.lock();
+        if ( locked_) {
+            splk_.unlock();
+            return false;
+        }
+        locked_ = true;
+        splk_.unlock();
+        set_owner();
+        return true;
+    }
+
+    // a waiting fiber is resumed and runs until it suspends again
+    void unlock() {
+        disown_();
+        unlock_();
+    }
+};
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_MUTEX_H
@@ -0,0 +1,203 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_NURSERY_H
+#define BOOST_CONTEXT_NURSERY_H
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/wait_queue.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+// scope of child fibers: spawn() queues a child, join() runs the children
+// round-robin until all of them terminated; a child parked by a fiber-aware
+// primitive is resumed by the notifier
+// the first exception thrown by a child is rethrown by join(), the siblings
+// are cancelled (cooperatively, see cancelled())
+class nursery {
+private:
+    pooled_fixedsize_stack      salloc_;
+    detail::spinlock            splk_{};
+    std::deque< fiber >         ready_{};
+    std::size_t                 running_{ 0 };
+    detail::wait_queue          joiners_{};
+    std::exception_ptr          except_{};
+    std::atomic< bool >         cancelled_{ false };
+
+    void fail_( std::exception_ptr except) noexcept {
+        splk_.lock();
+        if ( ! except_) {
+            except_ = std::move( except);
+        }
+        splk_.unlock();
+        cancel();
+    }
+
+    // last access of a child to the nursery, might resume the joining context
+    void done_() {
+        splk_.lock();
+        BOOST_ASSERT( 0 < running_);
+        if ( 0 != --running_) {
+            splk_.unlock();
+            return;
+        }
+        detail::wait_node * n = joiners_.pop_all();
+        splk_.unlock();
+        detail::notify_all( n);
+    }
+
+    bool join_() {
+        return join_( [](){ return false; });
+    }
+
+    template< typename Poll >
+    bool join_( Poll && poll) {
+        for (;;) {
+            splk_.lock();
+            if ( ! ready_.empty() ) {
+                fiber f = std::move( ready_.front() );
+                ready_.pop_front();
+                splk_.unlock();
+                // the scheduler of the joining context is kept on its stack
+                // meanwhile, the child registers the joining context
+                fiber sched = std::move( detail::scheduler_slot() );
+                f = std::move( f).resume();
+                detail::scheduler_slot() = std::move( sched);
+                if ( f) {
+                    // yielded
+                    splk_.lock();
+                    ready_.push_back( std::move( f) );
+                    splk_.unlock();
+                }
+                continue;
+            }
+            if ( 0 == running_) {
+                const bool failed = static_cast< bool >( except_);
+                splk_.unlock();
+                return failed;
+            }
+            splk_.unlock();
+            if ( poll() ) {
+                continue;
+            }
+            splk_.lock();
+            if ( ! ready_.empty() || 0 == running_) {
+                splk_.unlock();
+                continue;
+            }
+            // children parked elsewhere, the last one wakes the joining context
+            detail::wait_node n;
+            detail::wait( joiners_, splk_, n);
+        }
+    }
+
+public:
+    // children allocate their stacks from `salloc`, might be shared
+    // between nurseries
+    explicit nursery( pooled_fixedsize_stack salloc = pooled_fixedsize_stack{}) noexcept :
+        salloc_( std::move( salloc) ) {
+    }
+
+    // cancels and joins the remaining children, their exceptions are dropped
+    ~nursery() {
+        cancel();
+        join_();
+    }
+
+    nursery( nursery const&) = delete;
+    nursery & operator=( nursery const&) = delete;
+
+    // might be called by children (also running on other threads)
+    template< typename Fn >
+    void spawn( Fn fn) {
+        spawn( std::move( fn), [](){});
+    }
+
+    // `on_cancel` is called instead of `fn` if the nursery was cancelled
+    // before the child started
+    template< typename Fn, typename OnCancel >
+    void spawn( Fn fn, OnCancel on_cancel) {
+        fiber f{ std::allocator_arg, salloc_,
+                 [this,fn,on_cancel]( fiber && sched) mutable {
+                    this_fiber::set_scheduler( std::move( sched) );
+                    try {
+                        if ( ! cancelled() ) {
+                            fn();
+                        } else {
+                            on_cancel();
+                        }
+                    } catch ( detail::forced_unwind const&) {
+                        done_();
+                        throw;
+                    } catch (...) {
+                        fail_( std::current_exception() );
+                    }
+                    done_();
+                    return this_fiber::release_scheduler();
+                 }};
+        splk_.lock();
+        ++running_;
+        ready_.push_back( std::move( f) );
+        splk_.unlock();
+    }
+
+    // runs the children until all terminated; rethrows the first
+    // exception thrown by a child
+    void join() {
+        if ( join_() ) {
+            std::exception_ptr except;
+            std::swap( except, except_);
+            std::rethrow_exception( except);
+        }
+    }
+
+    // as join(), but while children are parked and none is queued `poll()` is
+    // called (e.g. reactor::run_once()); the joining context parks only if it
+    // returns false
+    template< typename Poll >
+    void join( Poll && poll) {
+        if ( join_( std::forward< Poll >( poll) ) ) {
+            std::exception_ptr except;
+            std::swap( except, except_);
+            std::rethrow_exception( except);
+        }
+    }
+
+    // requests the children to return early
+    void cancel() noexcept {
+        cancelled_.store( true, std::memory_order_relaxed);
+    }
+
+    // checked by the children at points of cancellation
+    bool cancelled() const noexcept {
+        return cancelled_.load( std::memory_order_relaxed);
+    }
+};
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_NURSERY_H
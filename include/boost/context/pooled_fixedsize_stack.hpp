@@ -11,6 +11,7 @@
 #include <cstddef>
 #include <cstdlib>
 #include <new>
+#include <vector>
 
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
@@ -18,6 +19,10 @@
 #include <boost/pool/pool.hpp>
 
 #include <boost/context/detail/config.hpp>
+#include <boost/context/detail/externc.hpp>
+#include <boost/context/detail/prefault.hpp>
+#include <boost/context/detail/shadow_stack.hpp>
+#include <boost/context/detail/spinlock.hpp>
 #include <boost/context/stack_context.hpp>
 #include <boost/context/stack_traits.hpp>
 
@@ -69,45 +74,112 @@ class basic_pooled_fixedsize_stack {
 private:
     class storage {
     private:
-        std::atomic< std::size_t >                                  use_count_;
-        std::size_t                                                 stack_size_;
 #if defined(BOOST_CONTEXT_USE_MAP_STACK)
-        boost::pool< detail::map_stack_allocator< traitsT > >       storage_;
+        typedef detail::map_stack_allocator< traitsT >              user_allocator;
 #else
-        boost::pool< boost::default_user_allocator_malloc_free >    storage_;
+        typedef boost::default_user_allocator_malloc_free           user_allocator;
 #endif
 
+        std::atomic< std::size_t >                                  use_count_;
+        std::size_t                                                 stack_size_;
+        std::size_t                                                 prefault_;
+        // a fiber might be deallocated on another thread (migration)
+        detail::spinlock                                            splk_{};
+        boost::pool< user_allocator >                               storage_;
+
     public:
-        storage( std::size_t stack_size, std::size_t next_size, std::size_t max_size) :
+        storage( std::size_t stack_size, std::size_t next_size, std::size_t max_size, std::size_t prefault) :
                 use_count_( 0),
                 stack_size_( stack_size),
+                prefault_( prefault),
                 storage_( stack_size, next_size, max_size) {
             BOOST_ASSERT( traits_type::is_unbounded() || ( traits_type::maximum_size() >= stack_size_) );
         }
 
-        stack_context allocate() {
-            void * vp = storage_.malloc();
+        std::size_t stack_size() const noexcept {
+            return stack_size_;
+        }
+
+        // stacks larger than the pooled stacks are
+        // allocated directly, bypassing the pool
+        stack_context allocate( std::size_t size) {
+            void * vp = nullptr;
+            if ( size <= stack_size_) {
+                size = stack_size_;
+                splk_.lock();
+                vp = storage_.malloc();
+                splk_.unlock();
+            } else {
+                vp = user_allocator::malloc( size);
+            }
             if ( ! vp) {
                 throw std::bad_alloc();
             }
             stack_context sctx;
-            sctx.size = stack_size_;
+            sctx.size = size;
             sctx.sp = static_cast< char * >( vp) + sctx.size;
+            // cheap if the stack was pre-faulted by reserve() or used before
+            detail::prefault( sctx.sp, sctx.size, prefault_, traits_type::page_size() );
 #if defined(BOOST_USE_VALGRIND)
             sctx.valgrind_stack_id = VALGRIND_STACK_REGISTER( sctx.sp, vp);
+#endif
+#if BOOST_CONTEXT_SHADOW_STACK
+            detail::shadow_stack_allocate( sctx);
 #endif
             return sctx;
         }
 
+        // takes `n` stacks from the pool (growing it if required), pre-faults
+        // them outside of the lock and puts them back
+        void reserve( std::size_t n) {
+            std::vector< void * > stacks;
+            stacks.reserve( n);
+            splk_.lock();
+            for ( std::size_t i = 0; i < n; ++i) {
+                void * vp = storage_.malloc();
+                if ( ! vp) {
+                    break;
+                }
+                stacks.push_back( vp);
+            }
+            splk_.unlock();
+            for ( void * vp : stacks) {
+                detail::prefault( static_cast< char * >( vp) + stack_size_, stack_size_, prefault_, traits_type::page_size() );
+            }
+            splk_.lock();
+            // reverse order: the pool hands out the first stack next
+            for ( auto i = stacks.rbegin(); i != stacks.rend(); ++i) {
+                storage_.free( * i);
+            }
+            splk_.unlock();
+            if ( stacks.size() < n) {
+                throw std::bad_alloc();
+            }
+        }
+
         void deallocate( stack_context & sctx) BOOST_NOEXCEPT_OR_NOTHROW {
             BOOST_ASSERT( sctx.sp);
             BOOST_ASSERT( traits_type::is_unbounded() || ( traits_type::maximum_size() >= sctx.size) );
 
 #if defined(BOOST_USE_VALGRIND)
             VALGRIND_STACK_DEREGISTER( sctx.valgrind_stack_id);
+#endif
+#if BOOST_CONTEXT_SHADOW_STACK
+            detail::shadow_stack_deallocate( sctx);
 #endif
             void * vp = static_cast< char * >( sctx.sp) - sctx.size;
-            storage_.free( vp);
+            if ( sctx.size == stack_size_) {
+#if defined(BOOST_USE_ASAN)
+                // the frames of the terminated fiber stay poisoned otherwise,
+                // the next fiber using the stack would be reported
+                __asan_unpoison_memory_region( vp, sctx.size);
+#endif
+                splk_.lock();
+                storage_.free( vp);
+                splk_.unlock();
+            } else {
+                user_allocator::free( static_cast< char * >( vp) );
+            }
         }
 
         friend void intrusive_ptr_add_ref( storage * s) noexcept {
@@ -126,19 +198,37 @@ private:
 public:
     typedef traitsT traits_type;
 
+    // the top `prefault` bytes of each stack are resident when it is returned
     basic_pooled_fixedsize_stack( std::size_t stack_size = traits_type::default_size(),
                            std::size_t next_size = 32,
-                           std::size_t max_size = 0) BOOST_NOEXCEPT_OR_NOTHROW :
-        storage_( new storage( stack_size, next_size, max_size) ) {
+                           std::size_t max_size = 0,
+                           std::size_t prefault = 0) BOOST_NOEXCEPT_OR_NOTHROW :
+        storage_( new storage( stack_size, next_size, max_size, prefault) ) {
+    }
+
+    std::size_t stack_size() const noexcept {
+        return storage_->stack_size();
     }
 
     stack_context allocate() {
-        return storage_->allocate();
+        return storage_->allocate( storage_->stack_size() );
+    }
+
+    // pooled stack if `size` fits into it, sctx.size is the granted size
+    stack_context allocate( std::size_t size) {
+        return storage_->allocate( size);
     }
 
     void deallocate( stack_context & sctx) BOOST_NOEXCEPT_OR_NOTHROW {
         storage_->deallocate( sctx);
     }
+
+    // makes `n` pre-faulted stacks available ahead of a burst of allocations;
+    // thread-safe, might run on a background thread (on a copy of the
+    // allocator, sharing the pool)
+    void reserve( std::size_t n) {
+        storage_->reserve( n);
+    }
 };
 
 typedef basic_pooled_fixedsize_stack< stack_traits >  pooled_fixedsize_stack;
@@ -23,6 +23,8 @@ extern "C" {
 #include <boost/core/ignore_unused.hpp>
 
 #include <boost/context/detail/config.hpp>
+#include <boost/context/detail/prefault.hpp>
+#include <boost/context/detail/shadow_stack.hpp>
 #include <boost/context/stack_context.hpp>
 #include <boost/context/stack_traits.hpp>
 
@@ -41,17 +43,27 @@ template< typename traitsT >
 class basic_protected_fixedsize_stack {
 private:
     std::size_t     size_;
+    std::size_t     prefault_;
 
 public:
     typedef traitsT traits_type;
 
-    basic_protected_fixedsize_stack( std::size_t size = traits_type::default_size() ) BOOST_NOEXCEPT_OR_NOTHROW :
-        size_( size) {
+    // the top `prefault` bytes of each stack are resident when it is returned
+    basic_protected_fixedsize_stack( std::size_t size = traits_type::default_size(),
+                                     std::size_t prefault = 0) BOOST_NOEXCEPT_OR_NOTHROW :
+        size_( size),
+        prefault_( prefault) {
     }
 
     stack_context allocate() {
+        return allocate( size_);
+    }
+
+    // stack of at least `size` bytes, sctx.size is the granted size
+    // (whole pages including the guard-page)
+    stack_context allocate( std::size_t size) {
         // calculate how many pages are required
-        const std::size_t pages = (size_ + traits_type::page_size() - 1) / traits_type::page_size();
+        const std::size_t pages = (size + traits_type::page_size() - 1) / traits_type::page_size();
         // add one page at bottom that will be used as guard-page
         const std::size_t size__ = ( pages + 1) * traits_type::page_size();
 
@@ -72,8 +84,13 @@ public:
         stack_context sctx;
         sctx.size = size__;
         sctx.sp = static_cast< char * >( vp) + sctx.size;
+        // not the guard-page
+        detail::prefault( sctx.sp, sctx.size - traits_type::page_size(), prefault_, traits_type::page_size() );
 #if defined(BOOST_USE_VALGRIND)
         sctx.valgrind_stack_id = VALGRIND_STACK_REGISTER( sctx.sp, vp);
+#endif
+#if BOOST_CONTEXT_SHADOW_STACK
+        detail::shadow_stack_allocate( sctx);
 #endif
         return sctx;
     }
@@ -84,6 +101,9 @@ public:
 #if defined(BOOST_USE_VALGRIND)
         VALGRIND_STACK_DEREGISTER( sctx.valgrind_stack_id);
 #endif
+#if BOOST_CONTEXT_SHADOW_STACK
+        detail::shadow_stack_deallocate( sctx);
+#endif
 
         void * vp = static_cast< char * >( sctx.sp) - sctx.size;
         // conform to POSIX.4 (POSIX.1b-1993, _POSIX_C_SOURCE=199309L)
@@ -50,8 +50,13 @@ public:
     }
 
     stack_context allocate() {
+        return allocate( size_);
+    }
+
+    // `size` is the size of the initial segment, sctx.size the granted size
+    stack_context allocate( std::size_t size) {
         stack_context sctx;
-        void * vp = __splitstack_makecontext( size_, sctx.segments_ctx, & sctx.size);
+        void * vp = __splitstack_makecontext( size, sctx.segments_ctx, & sctx.size);
         if ( ! vp) throw std::bad_alloc();
 
         // sctx.size is already filled by __splitstack_makecontext
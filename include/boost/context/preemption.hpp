@@ -0,0 +1,221 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_PREEMPTION_H
+#define BOOST_CONTEXT_PREEMPTION_H
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/opaque_tls.hpp>
+
+#if ! defined(__linux__)
+# error "Boost.Context: preemption requires timer_create() with SIGEV_THREAD_ID (Linux)"
+#endif
+
+extern "C" {
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+}
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <system_error>
+#include <utility>
+
+#include <boost/assert.hpp>
+
+#include <boost/context/fiber.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+// signal of the preemption timers
+#if ! defined(BOOST_CONTEXT_PREEMPTION_SIGNAL)
+# define BOOST_CONTEXT_PREEMPTION_SIGNAL SIGURG
+#endif
+
+namespace boost {
+namespace context {
+namespace detail {
+
+struct preemption_state {
+    // nesting of the preemptible regions of the running fiber
+    volatile std::sig_atomic_t      depth{ 0 };
+    // timer ticks since the running fiber entered or resumed its region
+    volatile std::sig_atomic_t      ticks{ 0 };
+};
+
+inline
+preemption_state & preemption_state_() noexcept {
+    return opaque_tls< preemption_state >();
+}
+
+// restores the region of the preempted fiber, also if it is unwound
+class preemption_restore {
+private:
+    std::sig_atomic_t   depth_;
+
+public:
+    explicit preemption_restore( std::sig_atomic_t depth) noexcept :
+        depth_{ depth } {
+    }
+
+    ~preemption_restore() {
+        // might run on another thread now
+        preemption_state & s = preemption_state_();
+        s.ticks = 0;
+        s.depth = depth_;
+    }
+};
+
+// signal handler: a fiber interrupted inside a preemptible region for at
+// least one quantum is suspended on top of its scheduler as by yield()
+inline
+void preempt( int, ::siginfo_t *, void *) {
+    preemption_state & s = preemption_state_();
+    if ( 0 == s.depth || 2 > ++s.ticks) {
+        return;
+    }
+    const int err = errno;
+    // the scheduler and the fibers it resumes are not preempted until they
+    // enter a region
+    const preemption_restore r{ s.depth };
+    s.depth = 0;
+    std::atomic_signal_fence( std::memory_order_seq_cst);
+    this_fiber::suspend_with(
+        []( fiber && f) -> fiber {
+            // the scheduler receives the preempted fiber
+            return std::move( f);
+        });
+    errno = err;
+}
+
+}
+
+// periodic timer of the running thread measuring its CPU time, sends
+// BOOST_CONTEXT_PREEMPTION_SIGNAL each `quantum`; a fiber running inside a
+// preemptible region (this_fiber::preemptible) for at least one quantum is
+// suspended and returned to its scheduler as if it had called yield()
+class preemption_timer {
+private:
+    ::timer_t   timer_;
+
+    static void install_() {
+        static const int result = [](){
+            struct ::sigaction sa{};
+            sa.sa_sigaction = & detail::preempt;
+            // SA_NODEFER: the signal is not blocked while the scheduler runs
+            // on the stack of the interrupted fiber
+            sa.sa_flags = SA_SIGINFO | SA_RESTART | SA_NODEFER;
+            ::sigemptyset( & sa.sa_mask);
+            return ::sigaction( BOOST_CONTEXT_PREEMPTION_SIGNAL, & sa, nullptr);
+        }();
+        if ( 0 != result) {
+            throw std::system_error{ errno, std::system_category(), "sigaction() failed" };
+        }
+    }
+
+public:
+    explicit preemption_timer( std::chrono::microseconds quantum = std::chrono::milliseconds{ 10 }) {
+        BOOST_ASSERT( 0 < quantum.count() );
+        install_();
+        // initializes the thread local state outside of the signal handler
+        detail::preemption_state_();
+        ::sigevent sev{};
+        sev.sigev_notify = SIGEV_THREAD_ID;
+        sev.sigev_signo = BOOST_CONTEXT_PREEMPTION_SIGNAL;
+#if defined(sigev_notify_thread_id)
+        sev.sigev_notify_thread_id = static_cast< ::pid_t >( ::syscall( SYS_gettid) );
+#else
+        sev._sigev_un._tid = static_cast< ::pid_t >( ::syscall( SYS_gettid) );
+#endif
+        if ( 0 != ::timer_create( CLOCK_THREAD_CPUTIME_ID, & sev, & timer_) ) {
+            throw std::system_error{ errno, std::system_category(), "timer_create() failed" };
+        }
+        ::itimerspec its{};
+        its.it_interval.tv_sec = static_cast< ::time_t >( quantum.count() / 1000000);
+        its.it_interval.tv_nsec = static_cast< long >( quantum.count() % 1000000) * 1000;
+        its.it_value = its.it_interval;
+        if ( 0 != ::timer_settime( timer_, 0, & its, nullptr) ) {
+            const int err = errno;
+            ::timer_delete( timer_);
+            throw std::system_error{ err, std::system_category(), "timer_settime() failed" };
+        }
+    }
+
+    ~preemption_timer() {
+        ::timer_delete( timer_);
+    }
+
+    preemption_timer( preemption_timer const&) = delete;
+    preemption_timer & operator=( preemption_timer const&) = delete;
+};
+
+namespace this_fiber {
+
+// scope in which the running fiber (scheduler registered) might be preempted
+// by the preemption timer of the thread; the code inside must not hold locks,
+// allocate memory or suspend the fiber (yield, park) - the scheduler runs on
+// top of the interrupted code
+class preemptible {
+private:
+    // blocks the signal while the state is updated: a fiber preempted in
+    // between might be resumed on another thread
+    class blocked {
+    private:
+        ::sigset_t  prev_;
+
+    public:
+        blocked() noexcept {
+            ::sigset_t set;
+            ::sigemptyset( & set);
+            ::sigaddset( & set, BOOST_CONTEXT_PREEMPTION_SIGNAL);
+            ::pthread_sigmask( SIG_BLOCK, & set, & prev_);
+        }
+
+        ~blocked() {
+            ::pthread_sigmask( SIG_SETMASK, & prev_, nullptr);
+        }
+    };
+
+public:
+    preemptible() noexcept {
+        BOOST_ASSERT( has_scheduler() );
+        const blocked b;
+        detail::preemption_state & s = detail::preemption_state_();
+        if ( 0 == s.depth) {
+            s.ticks = 0;
+        }
+        s.depth = s.depth + 1;
+    }
+
+    ~preemptible() {
+        const blocked b;
+        detail::preemption_state & s = detail::preemption_state_();
+        BOOST_ASSERT( 0 < s.depth);
+        s.depth = s.depth - 1;
+    }
+
+    preemptible( preemptible const&) = delete;
+    preemptible & operator=( preemptible const&) = delete;
+};
+
+}
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_PREEMPTION_H
@@ -0,0 +1,282 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_REACTOR_H
+#define BOOST_CONTEXT_REACTOR_H
+
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+
+#if ! defined(__linux__)
+# error "Boost.Context: reactor requires epoll (Linux)"
+#endif
+
+extern "C" {
+#include <errno.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+}
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <boost/context/fiber.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+// epoll based readiness notification for the fibers of one thread: wait()
+// parks the running fiber until the file descriptor is ready (or the timeout
+// expired), run_once() resumes the fibers whose file descriptors became ready
+// the first reactor of a thread is its current reactor, used by the
+// interposition of the blocking socket calls (library boost_context_interpose)
+class reactor {
+private:
+    typedef std::chrono::steady_clock               clock_type;
+
+    struct waiter;
+    typedef std::multimap< clock_type::time_point, waiter * >   timer_queue;
+
+    struct waiter {
+        waiter                  *   next{ nullptr };
+        int                         fd;
+        std::uint32_t               events;
+        std::uint32_t               revents{ 0 };
+        fiber                       f{};
+        bool                        timed{ false };
+        timer_queue::iterator       timer{};
+    };
+
+    // waiters of a file descriptor, `interest` is registered at epoll
+    struct descriptor {
+        waiter          *   head{ nullptr };
+        std::uint32_t       interest{ 0 };
+    };
+
+    int                                         epfd_;
+    std::unordered_map< int, descriptor >       descriptors_{};
+    timer_queue                                 timers_{};
+    std::size_t                                 waiting_{ 0 };
+
+    static reactor *& current_() noexcept {
+        thread_local static reactor * r = nullptr;
+        return r;
+    }
+
+    // registers the union of the events of the waiters
+    bool update_( int fd, descriptor & d) noexcept {
+        std::uint32_t interest = 0;
+        for ( waiter * w = d.head; nullptr != w; w = w->next) {
+            interest |= w->events;
+        }
+        if ( interest == d.interest) {
+            return true;
+        }
+        int result;
+        if ( 0 == interest) {
+            result = ::epoll_ctl( epfd_, EPOLL_CTL_DEL, fd, nullptr);
+        } else {
+            ::epoll_event ev{};
+            ev.events = interest;
+            ev.data.fd = fd;
+            result = ::epoll_ctl( epfd_, 0 == d.interest ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, fd, & ev);
+        }
+        d.interest = 0 == result ? interest : 0;
+        return 0 == result;
+    }
+
+    void unlink_( waiter * w) noexcept {
+        auto i = descriptors_.find( w->fd);
+        BOOST_ASSERT( descriptors_.end() != i);
+        for ( waiter ** p = & i->second.head; nullptr != * p; p = & ( * p)->next) {
+            if ( w == * p) {
+                * p = w->next;
+                break;
+            }
+        }
+        if ( w->timed) {
+            timers_.erase( w->timer);
+        }
+        update_( w->fd, i->second);
+        if ( nullptr == i->second.head) {
+            descriptors_.erase( i);
+        }
+        --waiting_;
+    }
+
+    // resumes the woken fibers, each runs until it parks again or terminates
+    static void resume_( std::vector< waiter * > & woken) {
+        for ( waiter * w : woken) {
+            // `w` lives on the stack of the fiber
+            detail::resume_parked( std::move( w->f) );
+        }
+    }
+
+public:
+    reactor() :
+        epfd_{ ::epoll_create1( EPOLL_CLOEXEC) } {
+        if ( -1 == epfd_) {
+            throw std::system_error{ errno, std::system_category(), "epoll_create1() failed" };
+        }
+        if ( nullptr == current_() ) {
+            current_() = this;
+        }
+    }
+
+    ~reactor() {
+        BOOST_ASSERT( 0 == waiting_);
+        if ( this == current_() ) {
+            current_() = nullptr;
+        }
+        ::close( epfd_);
+    }
+
+    reactor( reactor const&) = delete;
+    reactor & operator=( reactor const&) = delete;
+
+    // current reactor of the running thread, might be null
+    static reactor * current() noexcept {
+        return current_();
+    }
+
+    // number of parked fibers
+    std::size_t waiting() const noexcept {
+        return waiting_;
+    }
+
+    // parks the running fiber (scheduler registered) until `fd` is ready for
+    // `events` (EPOLLIN, EPOLLOUT ...) or `timeout` (milliseconds, -1 infinite)
+    // expired; returns the ready events, 0 if the timeout expired
+    // a file descriptor not supported by epoll (regular file) is ready
+    std::uint32_t wait( int fd, std::uint32_t events, int timeout = -1) {
+        BOOST_ASSERT( this_fiber::has_scheduler() );
+        waiter w;
+        w.fd = fd;
+        w.events = events;
+        descriptor & d = descriptors_[fd];
+        w.next = d.head;
+        d.head = & w;
+        if ( ! update_( fd, d) ) {
+            d.head = w.next;
+            if ( nullptr == d.head) {
+                descriptors_.erase( fd);
+            }
+            return events;
+        }
+        if ( 0 <= timeout) {
+            w.timed = true;
+            w.timer = timers_.emplace( clock_type::now() + std::chrono::milliseconds{ timeout }, & w);
+        }
+        ++waiting_;
+        this_fiber::suspend_with(
+            [&w]( fiber && f) -> fiber {
+                w.f = std::move( f);
+                return fiber{};
+            });
+        return w.revents;
+    }
+
+    // wakes the fibers waiting for `fd`; must be called while `fd` is open,
+    // epoll could not deregister it otherwise
+    void cancel( int fd) {
+        cancel( fd, [](){});
+    }
+
+    // as cancel( fd), `fn` is called after `fd` was deregistered and before
+    // the fibers are resumed (closes `fd`)
+    template< typename Fn >
+    void cancel( int fd, Fn && fn) {
+        std::vector< waiter * > woken;
+        auto i = descriptors_.find( fd);
+        if ( descriptors_.end() != i) {
+            for ( waiter * w = i->second.head; nullptr != w; w = w->next) {
+                w->revents = EPOLLERR | EPOLLHUP;
+                woken.push_back( w);
+            }
+            for ( waiter * w : woken) {
+                unlink_( w);
+            }
+        }
+        fn();
+        resume_( woken);
+    }
+
+    // waits at most `timeout` milliseconds (-1 infinite) for ready file
+    // descriptors and expired timeouts, resumes the fibers waiting for them;
+    // returns false if no fiber is waiting
+    bool run_once( int timeout = -1) {
+        if ( 0 == waiting_) {
+            return false;
+        }
+        if ( ! timers_.empty() ) {
+            const auto d = timers_.begin()->first - clock_type::now();
+            auto remaining = std::chrono::duration_cast< std::chrono::milliseconds >( d);
+            // rounded up, do not wake before the deadline
+            if ( remaining < d) {
+                ++remaining;
+            }
+            const int t = 0 < remaining.count() ? static_cast< int >( remaining.count() ) : 0;
+            if ( 0 > timeout || t < timeout) {
+                timeout = t;
+            }
+        }
+        ::epoll_event events[64];
+        int n = ::epoll_wait( epfd_, events, 64, timeout);
+        if ( -1 == n) {
+            if ( EINTR != errno) {
+                throw std::system_error{ errno, std::system_category(), "epoll_wait() failed" };
+            }
+            n = 0;
+        }
+        std::vector< waiter * > woken;
+        for ( int i = 0; i < n; ++i) {
+            auto d = descriptors_.find( events[i].data.fd);
+            if ( descriptors_.end() == d) {
+                continue;
+            }
+            // errors and hang-up wake all waiters
+            const std::uint32_t ready = events[i].events;
+            for ( waiter * w = d->second.head; nullptr != w; w = w->next) {
+                if ( 0 != ( ready & ( w->events | EPOLLERR | EPOLLHUP) ) ) {
+                    w->revents = ready;
+                    woken.push_back( w);
+                }
+            }
+        }
+        const auto now = clock_type::now();
+        for ( auto i = timers_.begin(); timers_.end() != i && i->first <= now; ++i) {
+            if ( 0 == i->second->revents) {
+                woken.push_back( i->second);
+            }
+        }
+        for ( waiter * w : woken) {
+            unlink_( w);
+        }
+        resume_( woken);
+        return true;
+    }
+};
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_REACTOR_H
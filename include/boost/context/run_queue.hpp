@@ -0,0 +1,131 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_RUN_QUEUE_H
+#define BOOST_CONTEXT_RUN_QUEUE_H
+
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+// ready fibers of one thread switching directly to each other: yield() resumes
+// the next ready fiber on top of which the yielding fiber is queued again (one
+// switch instead of two via a scheduler); a terminating fiber switches to the
+// next ready fiber, the last one back to the context running run()
+// the first exception thrown by a fiber is rethrown by run()
+class run_queue {
+private:
+    pooled_fixedsize_stack      salloc_;
+    std::deque< fiber >         ready_{};
+    // context running run(), resumed after the last fiber terminated
+    fiber                       owner_{};
+    std::exception_ptr          except_{};
+
+    fiber next_() noexcept {
+        if ( ready_.empty() ) {
+            return std::move( owner_);
+        }
+        fiber f = std::move( ready_.front() );
+        ready_.pop_front();
+        return f;
+    }
+
+public:
+    explicit run_queue( pooled_fixedsize_stack salloc = pooled_fixedsize_stack{}) noexcept :
+        salloc_( std::move( salloc) ) {
+    }
+
+    // the remaining fibers are unwound
+    ~run_queue() = default;
+
+    run_queue( run_queue const&) = delete;
+    run_queue & operator=( run_queue const&) = delete;
+
+    // queues a fiber calling `fn`; might be called by the fibers
+    template< typename Fn >
+    void spawn( Fn fn) {
+        fiber f{ std::allocator_arg, salloc_,
+            [this,fn]( fiber && spawner) mutable -> fiber {
+                // suspended at once, afterwards resumed by resume_with() on
+                // top of which its predecessor is queued (empty fiber here)
+                spawner = std::move( spawner).resume();
+                BOOST_ASSERT( ! spawner);
+                try {
+                    fn();
+                } catch ( detail::forced_unwind const&) {
+                    throw;
+                } catch (...) {
+                    if ( ! except_) {
+                        except_ = std::current_exception();
+                    }
+                }
+                return next_();
+            }};
+        ready_.push_back( std::move( f).resume() );
+    }
+
+    // runs the fibers until all of them terminated, the calling context is
+    // suspended meanwhile; must not be called by a fiber of the queue
+    void run() {
+        while ( ! ready_.empty() ) {
+            fiber f = std::move( ready_.front() );
+            ready_.pop_front();
+            std::move( f).resume_with(
+                [this]( fiber && owner) -> fiber {
+                    owner_ = std::move( owner);
+                    return fiber{};
+                });
+        }
+        if ( except_) {
+            std::exception_ptr except;
+            std::swap( except, except_);
+            std::rethrow_exception( except);
+        }
+    }
+
+    // called by a fiber of the queue: switches to the next ready fiber, the
+    // calling fiber is queued again; returns at once if no other is ready
+    void yield() {
+        if ( ready_.empty() ) {
+            return;
+        }
+        fiber f = std::move( ready_.front() );
+        ready_.pop_front();
+        std::move( f).resume_with(
+            [this]( fiber && prev) -> fiber {
+                ready_.push_back( std::move( prev) );
+                return fiber{};
+            });
+    }
+
+    // number of ready fibers, the running one excluded
+    std::size_t ready() const noexcept {
+        return ready_.size();
+    }
+};
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_RUN_QUEUE_H
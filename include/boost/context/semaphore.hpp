@@ -0,0 +1,92 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_SEMAPHORE_H
+#define BOOST_CONTEXT_SEMAPHORE_H
+
+#include <cstddef>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/wait_queue.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+// counting semaphore; release() hands the permits over to the waiters
+// in FIFO order
+class semaphore {
+private:
+    detail::spinlock        splk_{};
+    detail::wait_queue      waiters_{};
+    std::size_t             count_;
+
+public:
+    explicit semaphore( std::size_t count = 0) noexcept :
+        count_{ count } {
+    }
+
+    ~semaphore() {
+        BOOST_ASSERT( waiters_.empty() );
+    }
+
+    semaphore( semaphore const&) = delete;
+    semaphore & operator=( semaphore const&) = delete;
+
+    void acquire() {
+        splk_.lock();
+        if ( 0 < count_) {
+            --count_;
+            splk_.unlock();
+            return;
+        }
+        detail::wait_node n;
+        detail::wait( waiters_, splk_, n);
+    }
+
+    bool try_acquire() noexcept {
+        splk_.lock();
+        if ( 0 == count_) {
+            splk_.unlock();
+            return false;
+        }
+        --count_;
+        splk_.unlock();
+        return true;
+    }
+
+    // the woken fibers run until they suspend again
+    void release( std::size_t update = 1) {
+        detail::wait_node * head = nullptr;
+        detail::wait_node ** tail = & head;
+        splk_.lock();
+        for ( ; 0 < update; --update) {
+            detail::wait_node * n = waiters_.pop_front();
+            if ( nullptr == n) {
+                count_ += update;
+                break;
+            }
+            * tail = n;
+            tail = & n->next;
+        }
+        * tail = nullptr;
+        splk_.unlock();
+        detail::notify_all( head);
+    }
+};
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_SEMAPHORE_H
@@ -0,0 +1,294 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_SHARED_STACK_H
+#define BOOST_CONTEXT_SHARED_STACK_H
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/externc.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/preallocated.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
+#include <boost/context/stack_context.hpp>
+#include <boost/context/stack_traits.hpp>
+
+#if defined(BOOST_USE_UCONTEXT) || defined(BOOST_USE_WINFIB)
+# error "boost context: shared stacks require the fcontext_t based fiber"
+#endif
+#if BOOST_CONTEXT_SHADOW_STACK
+# error "boost context: shared stacks are not supported together with shadow stacks"
+#endif
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+// stack-copying fibers: the fibers of a shared_stack execute on one stack;
+// the used part of the stack of a suspended fiber (saved stack pointer up to
+// the stack top, including its fiber_record) is copied into a buffer of the
+// fiber when another fiber of the group needs the stack, and copied back
+// before the fiber is resumed (lazy - nothing is copied as long as the fiber
+// is resumed again before another fiber of the group)
+
+namespace boost {
+namespace context {
+
+class shared_fiber;
+
+namespace detail {
+
+// the stack is owned by shared_stack; tells shared_fiber::resume() that the
+// fiber terminated (instead of being suspended elsewhere)
+struct shared_stack_allocator {
+    bool    *   terminated;
+
+    void deallocate( stack_context &) noexcept {
+        * terminated = true;
+    }
+};
+
+inline
+void copy_stack( void * to, void const* from, std::size_t size) noexcept {
+#if defined(BOOST_USE_ASAN)
+    // frames of the suspended fibers contain poisoned redzones
+    __asan_unpoison_memory_region( from, size);
+    __asan_unpoison_memory_region( to, size);
+#endif
+    std::memcpy( to, from, size);
+}
+
+}
+
+class shared_stack {
+private:
+    friend class shared_fiber;
+
+    protected_fixedsize_stack   salloc_;
+    stack_context               sctx_;
+    // fiber whose stack is resident
+    shared_fiber            *   occupant_{ nullptr };
+    // the occupant is running (or has resumed another context)
+    bool                        running_{ false };
+    bool                        terminated_{ false };
+    std::size_t                 fibers_{ 0 };
+
+    void evict_();
+
+    // the stack content is dead: frames of the previous occupant
+    // must not be reported to the next one
+    void unpoison_() noexcept {
+#if defined(BOOST_USE_ASAN)
+        __asan_unpoison_memory_region( static_cast< char * >( sctx_.sp) - sctx_.size, sctx_.size);
+#endif
+    }
+
+public:
+    explicit shared_stack( std::size_t size = stack_traits::default_size()) :
+        salloc_{ size },
+        sctx_( salloc_.allocate() ) {
+    }
+
+    ~shared_stack() {
+        BOOST_ASSERT_MSG( 0 == fibers_, "shared_stack destroyed before its fibers");
+        salloc_.deallocate( sctx_);
+    }
+
+    shared_stack( shared_stack const&) = delete;
+    shared_stack & operator=( shared_stack const&) = delete;
+
+    std::size_t size() const noexcept {
+        return sctx_.size;
+    }
+};
+
+// fiber executed on a shared_stack; its context-function must suspend by
+// resuming the context passed to it (the caller of resume()), it must not
+// resume a fiber of the same shared_stack
+class shared_fiber {
+private:
+    friend class shared_stack;
+
+    shared_stack    *   stack_{ nullptr };
+    fiber               f_{};
+    char            *   buffer_{ nullptr };
+    std::size_t         capacity_{ 0 };
+    std::size_t         size_{ 0 };
+
+    void save_() {
+        char * sp = static_cast< char * >( f_.fctx_);
+        char * top = static_cast< char * >( stack_->sctx_.sp);
+        BOOST_ASSERT( sp < top);
+        const std::size_t size = static_cast< std::size_t >( top - sp);
+        if ( capacity_ < size) {
+            // exactly sized, reused as long as the fiber does not grow
+            char * buffer = static_cast< char * >( ::operator new( size) );
+            ::operator delete( buffer_);
+            buffer_ = buffer;
+            capacity_ = size;
+        }
+        detail::copy_stack( buffer_, sp, size);
+        size_ = size;
+    }
+
+    void activate_() {
+        if ( this == stack_->occupant_) {
+            return;
+        }
+        stack_->evict_();
+        detail::copy_stack( static_cast< char * >( stack_->sctx_.sp) - size_, buffer_, size_);
+        stack_->occupant_ = this;
+    }
+
+    void terminated_() noexcept {
+        BOOST_ASSERT( this == stack_->occupant_);
+        stack_->occupant_ = nullptr;
+        stack_->terminated_ = false;
+        stack_->unpoison_();
+        --stack_->fibers_;
+        size_ = 0;
+    }
+
+    void switch_to_() {
+        stack_->running_ = true;
+        f_ = std::move( f_).resume();
+        stack_->running_ = false;
+        if ( ! f_) {
+            BOOST_ASSERT_MSG( stack_->terminated_, "shared_fiber suspended without resuming its caller");
+            terminated_();
+        }
+    }
+
+public:
+    shared_fiber() noexcept = default;
+
+    template< typename Fn >
+    shared_fiber( shared_stack & stack, Fn && fn) :
+            stack_{ & stack } {
+        stack.evict_();
+        f_ = fiber{ std::allocator_arg,
+                    preallocated{ stack.sctx_.sp, stack.sctx_.size, stack.sctx_ },
+                    detail::shared_stack_allocator{ & stack.terminated_ },
+                    std::forward< Fn >( fn) };
+        stack.occupant_ = this;
+        ++stack.fibers_;
+    }
+
+    // unwinds the stack of a suspended fiber
+    ~shared_fiber() {
+        if ( f_) {
+            activate_();
+            stack_->running_ = true;
+            {
+                fiber f = std::move( f_);
+            }
+            stack_->running_ = false;
+            terminated_();
+        }
+        ::operator delete( buffer_);
+    }
+
+    shared_fiber( shared_fiber && other) noexcept {
+        swap( other);
+    }
+
+    shared_fiber & operator=( shared_fiber && other) noexcept {
+        if ( BOOST_LIKELY( this != & other) ) {
+            shared_fiber tmp = std::move( other);
+            swap( tmp);
+        }
+        return * this;
+    }
+
+    shared_fiber( shared_fiber const& other) noexcept = delete;
+    shared_fiber & operator=( shared_fiber const& other) noexcept = delete;
+
+    // runs the fiber until it resumes its caller or terminates; the stack of
+    // another fiber of the shared_stack is saved, the own stack restored
+    void resume() {
+        BOOST_ASSERT( f_);
+        BOOST_ASSERT_MSG( ! stack_->running_ || this != stack_->occupant_, "shared_fiber is running");
+        activate_();
+        switch_to_();
+    }
+
+    explicit operator bool() const noexcept {
+        return static_cast< bool >( f_);
+    }
+
+    bool operator!() const noexcept {
+        return ! f_;
+    }
+
+    // bytes of the shared stack used by the fiber when it was suspended
+    // (copied into its buffer if evicted)
+    std::size_t stack_usage() const noexcept {
+        if ( f_ && this == stack_->occupant_) {
+            return static_cast< std::size_t >(
+                    static_cast< char * >( stack_->sctx_.sp) - static_cast< char * >( f_.fctx_) );
+        }
+        return size_;
+    }
+
+    // bytes allocated for the copy of the stack
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    void swap( shared_fiber & other) noexcept {
+        std::swap( stack_, other.stack_);
+        std::swap( f_, other.f_);
+        std::swap( buffer_, other.buffer_);
+        std::swap( capacity_, other.capacity_);
+        std::swap( size_, other.size_);
+        // the occupant of a stack is identified by its address
+        auto fix = [this,&other]( shared_stack * s) noexcept {
+            if ( nullptr == s) {
+                return;
+            }
+            if ( this == s->occupant_) {
+                s->occupant_ = & other;
+            } else if ( & other == s->occupant_) {
+                s->occupant_ = this;
+            }
+        };
+        fix( stack_);
+        if ( other.stack_ != stack_) {
+            fix( other.stack_);
+        }
+    }
+};
+
+inline
+void shared_stack::evict_() {
+    if ( nullptr == occupant_) {
+        return;
+    }
+    BOOST_ASSERT_MSG( ! running_, "shared_stack in use by a running fiber");
+    occupant_->save_();
+    occupant_ = nullptr;
+    unpoison_();
+}
+
+inline
+void swap( shared_fiber & l, shared_fiber & r) noexcept {
+    l.swap( r);
+}
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_SHARED_STACK_H
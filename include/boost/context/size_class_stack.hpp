@@ -0,0 +1,135 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_SIZE_CLASS_STACK_H
+#define BOOST_CONTEXT_SIZE_CLASS_STACK_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/intrusive_ptr.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/stack_context.hpp>
+#include <boost/context/stack_traits.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+namespace boost {
+namespace context {
+
+// separate pools of stacks for a few size classes (e.g. 16KB/64KB/256KB);
+// allocate( size) returns a stack of the smallest class that fits,
+// larger stacks are allocated without pooling
+template< typename traitsT >
+class basic_size_class_stack {
+private:
+    typedef basic_pooled_fixedsize_stack< traitsT >     pool_type;
+
+    class storage {
+    private:
+        std::atomic< std::size_t >  use_count_;
+        // ascending stack sizes
+        std::vector< pool_type >    pools_;
+
+    public:
+        storage( std::vector< std::size_t > sizes, std::size_t next_size, std::size_t max_size) :
+                use_count_( 0),
+                pools_() {
+            BOOST_ASSERT( ! sizes.empty() );
+            std::sort( sizes.begin(), sizes.end() );
+            sizes.erase( std::unique( sizes.begin(), sizes.end() ), sizes.end() );
+            pools_.reserve( sizes.size() );
+            for ( std::size_t size : sizes) {
+                pools_.emplace_back( size, next_size, max_size);
+            }
+        }
+
+        stack_context allocate( std::size_t size) {
+            for ( pool_type & pool : pools_) {
+                if ( size <= pool.stack_size() ) {
+                    return pool.allocate( size);
+                }
+            }
+            // larger than the largest size class
+            return pools_.back().allocate( size);
+        }
+
+        void deallocate( stack_context & sctx) noexcept {
+            for ( pool_type & pool : pools_) {
+                if ( sctx.size == pool.stack_size() ) {
+                    pool.deallocate( sctx);
+                    return;
+                }
+            }
+            pools_.back().deallocate( sctx);
+        }
+
+        std::size_t min_size() const noexcept {
+            return pools_.front().stack_size();
+        }
+
+        friend void intrusive_ptr_add_ref( storage * s) noexcept {
+            ++s->use_count_;
+        }
+
+        friend void intrusive_ptr_release( storage * s) noexcept {
+            if ( 0 == --s->use_count_) {
+                delete s;
+            }
+        }
+    };
+
+    intrusive_ptr< storage >    storage_;
+
+public:
+    typedef traitsT traits_type;
+
+    basic_size_class_stack( std::initializer_list< std::size_t > sizes = { 16 * 1024, 64 * 1024, 256 * 1024 },
+                            std::size_t next_size = 32,
+                            std::size_t max_size = 0) :
+        storage_( new storage( std::vector< std::size_t >( sizes), next_size, max_size) ) {
+    }
+
+    basic_size_class_stack( std::vector< std::size_t > sizes,
+                            std::size_t next_size = 32,
+                            std::size_t max_size = 0) :
+        storage_( new storage( std::move( sizes), next_size, max_size) ) {
+    }
+
+    // stack of the smallest size class
+    stack_context allocate() {
+        return storage_->allocate( storage_->min_size() );
+    }
+
+    // stack of the smallest size class holding `size` bytes,
+    // sctx.size is the granted size
+    stack_context allocate( std::size_t size) {
+        return storage_->allocate( size);
+    }
+
+    void deallocate( stack_context & sctx) BOOST_NOEXCEPT_OR_NOTHROW {
+        storage_->deallocate( sctx);
+    }
+};
+
+typedef basic_size_class_stack< stack_traits >  size_class_stack;
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_SIZE_CLASS_STACK_H
@@ -34,6 +34,11 @@ struct BOOST_CONTEXT_DECL stack_context {
 # if defined(BOOST_USE_VALGRIND)
     unsigned                valgrind_stack_id{ 0 };
 # endif
+# if BOOST_CONTEXT_SHADOW_STACK
+    void                *   shadow_stack{ nullptr };
+    std::size_t             shadow_stack_size{ 0 };
+    void                *   shadow_stack_sp{ nullptr };
+# endif
 };
 #else
 struct BOOST_CONTEXT_DECL stack_context {
@@ -49,6 +54,11 @@ struct BOOST_CONTEXT_DECL stack_context {
 # if defined(BOOST_USE_VALGRIND)
     unsigned                valgrind_stack_id;
 # endif
+# if BOOST_CONTEXT_SHADOW_STACK
+    void                *   shadow_stack;
+    std::size_t             shadow_stack_size;
+    void                *   shadow_stack_sp;
+# endif
 
     stack_context() :
         size( 0),
@@ -58,6 +68,11 @@ struct BOOST_CONTEXT_DECL stack_context {
 # endif
 # if defined(BOOST_USE_VALGRIND)
         , valgrind_stack_id( 0)
+# endif
+# if BOOST_CONTEXT_SHADOW_STACK
+        , shadow_stack( 0)
+        , shadow_stack_size( 0)
+        , shadow_stack_sp( 0)
 # endif
         {}
 };
@@ -0,0 +1,132 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_CONTEXT_THIS_FIBER_H
+#define BOOST_CONTEXT_THIS_FIBER_H
+
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include <boost/context/detail/config.hpp>
+#include <boost/context/detail/opaque_tls.hpp>
+#include <boost/context/fiber.hpp>
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+
+#if defined(BOOST_USE_UCONTEXT) || defined(BOOST_USE_WINFIB) || defined(BOOST_CONTEXT_CURRENT_FIBER)
+# define BOOST_CONTEXT_HAS_THIS_FIBER_ID
+#endif
+
+namespace boost {
+namespace context {
+namespace detail {
+
+struct scheduler_slot_tag;
+
+// scheduler of the running fiber
+inline
+fiber & scheduler_slot() noexcept {
+    return opaque_tls< scheduler_slot_tag, fiber >();
+}
+
+// resumes a fiber parked by a fiber-aware primitive; the running context is
+// its scheduler until it parks again or terminates, a yield returns to the
+// running context which resumes it immediately
+inline
+void resume_parked( fiber f) {
+    // the scheduler of the running context is kept on its stack meanwhile
+    fiber sched = std::move( scheduler_slot() );
+    while ( f) {
+        f = std::move( f).resume();
+    }
+    scheduler_slot() = std::move( sched);
+}
+
+}
+
+namespace this_fiber {
+
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+// identity of the running context, unique among the contexts alive
+inline
+void const* get_id() noexcept {
+# if defined(BOOST_USE_UCONTEXT) || defined(BOOST_USE_WINFIB)
+    return detail::fiber_activation_record::current();
+# else
+    void * id = detail::current_fiber();
+    // main context of the thread
+    return nullptr != id ? id : & detail::current_fiber();
+# endif
+}
+#endif
+
+#if defined(BOOST_CONTEXT_FIBER_STATS) && ! defined(BOOST_USE_UCONTEXT) && ! defined(BOOST_USE_WINFIB)
+// running/suspended ticks and resumptions of the running context
+inline
+fiber_stats stats() noexcept {
+    return detail::stats_current();
+}
+#endif
+
+// registers `sched` as the scheduler of the running fiber,
+// typically the fiber passed to the context-function
+inline
+void set_scheduler( fiber && sched) noexcept {
+    fiber & slot = detail::scheduler_slot();
+    BOOST_ASSERT( ! slot);
+    slot = std::move( sched);
+}
+
+// removes the scheduler of the running fiber,
+// e.g. to be returned by the context-function
+inline
+fiber release_scheduler() noexcept {
+    return std::move( detail::scheduler_slot() );
+}
+
+// true if a scheduler is registered for the running fiber
+inline
+bool has_scheduler() noexcept {
+    return static_cast< bool >( detail::scheduler_slot() );
+}
+
+// suspends the running fiber and resumes its scheduler which receives
+// the suspended fiber; the context resuming the fiber becomes its scheduler
+inline
+void yield() {
+    BOOST_ASSERT( detail::scheduler_slot() );
+    fiber sched = std::move( detail::scheduler_slot() ).resume();
+    // might be running on another thread now
+    fiber & slot = detail::scheduler_slot();
+    BOOST_ASSERT( ! slot);
+    slot = std::move( sched);
+}
+
+// suspends the running fiber and executes `fn` on top of its scheduler;
+// `fn` receives the suspended fiber and returns the fiber the scheduler
+// receives - an empty fiber if `fn` parked the suspended fiber elsewhere
+// (e.g. in the wait list of a channel)
+template< typename Fn >
+void suspend_with( Fn && fn) {
+    BOOST_ASSERT( detail::scheduler_slot() );
+    fiber sched = std::move( detail::scheduler_slot() ).resume_with( std::forward< Fn >( fn) );
+    fiber & slot = detail::scheduler_slot();
+    BOOST_ASSERT( ! slot);
+    slot = std::move( sched);
+}
+
+}
+
+}}
+
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+
+#endif // BOOST_CONTEXT_THIS_FIBER_H
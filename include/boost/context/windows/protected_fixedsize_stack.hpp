@@ -20,6 +20,7 @@ extern "C" {
 #include <boost/core/ignore_unused.hpp>
 
 #include <boost/context/detail/config.hpp>
+#include <boost/context/detail/prefault.hpp>
 #include <boost/context/stack_context.hpp>
 #include <boost/context/stack_traits.hpp>
 
@@ -34,17 +35,27 @@ template< typename traitsT >
 class basic_protected_fixedsize_stack {
 private:
     std::size_t     size_;
+    std::size_t     prefault_;
 
 public:
     typedef traitsT traits_type;
 
-    basic_protected_fixedsize_stack( std::size_t size = traits_type::default_size() ) BOOST_NOEXCEPT_OR_NOTHROW :
-        size_( size) {
+    // the top `prefault` bytes of each stack are resident when it is returned
+    basic_protected_fixedsize_stack( std::size_t size = traits_type::default_size(),
+                                     std::size_t prefault = 0) BOOST_NOEXCEPT_OR_NOTHROW :
+        size_( size),
+        prefault_( prefault) {
     }
 
     stack_context allocate() {
+        return allocate( size_);
+    }
+
+    // stack of at least `size` bytes, sctx.size is the granted size
+    // (whole pages including the guard-page)
+    stack_context allocate( std::size_t size) {
         // calculate how many pages are required
-        const std::size_t pages = (size_ + traits_type::page_size() - 1) / traits_type::page_size();
+        const std::size_t pages = (size + traits_type::page_size() - 1) / traits_type::page_size();
         // add one page at bottom that will be used as guard-page
         const std::size_t size__ = ( pages + 1) * traits_type::page_size();
 
@@ -60,6 +71,8 @@ public:
         stack_context sctx;
         sctx.size = size__;
         sctx.sp = static_cast< char * >( vp) + sctx.size;
+        // not the guard-page
+        detail::prefault( sctx.sp, sctx.size - traits_type::page_size(), prefault_, traits_type::page_size() );
         return sctx;
     }
 
@@ -0,0 +1,269 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#include "clock.hpp"
+
+// distribution of the samples of one benchmark,
+// each sample is the (overhead corrected) duration
+// of one operation in nano seconds
+struct summary {
+    std::size_t     samples{ 0 };
+    double          min{ 0 };
+    double          mean{ 0 };
+    double          p50{ 0 };
+    double          p90{ 0 };
+    double          p99{ 0 };
+    double          p999{ 0 };
+    double          max{ 0 };
+};
+
+// nearest-rank percentile of sorted samples
+inline
+double percentile( std::vector< double > const& sorted, double p) {
+    BOOST_ASSERT( ! sorted.empty() );
+    std::size_t rank = static_cast< std::size_t >( std::ceil( p / 100. * sorted.size() ) );
+    rank = ( std::max)( rank, std::size_t( 1) );
+    return sorted[( std::min)( rank, sorted.size() ) - 1];
+}
+
+inline
+summary summarize( std::vector< double > samples) {
+    summary s;
+    if ( samples.empty() ) {
+        return s;
+    }
+    std::sort( samples.begin(), samples.end() );
+    s.samples = samples.size();
+    s.min = samples.front();
+    s.max = samples.back();
+    s.mean = std::accumulate( samples.begin(), samples.end(), 0.) / samples.size();
+    s.p50 = percentile( samples, 50.);
+    s.p90 = percentile( samples, 90.);
+    s.p99 = percentile( samples, 99.);
+    s.p999 = percentile( samples, 99.9);
+    return s;
+}
+
+struct result {
+    std::string     scenario;
+    std::string     allocator;
+    // what one sample is divided by, e.g. 'switch'
+    std::string     unit;
+    summary         stats;
+    // hardware counters per unit (empty if not measured)
+    std::vector< std::pair< std::string, double > > counters{};
+};
+
+// each sample measures `batch` calls of `fn`;
+// returns the duration of one call per sample
+template< typename Fn >
+std::vector< double > measure( std::size_t samples, std::size_t batch, Fn && fn) {
+    BOOST_ASSERT( 0 < batch);
+    const double overhead = static_cast< double >(
+            boost::chrono::duration_cast< boost::chrono::nanoseconds >( overhead_clock() ).count() );
+    // warm-up of caches, branch predictors and CPU frequency
+    for ( std::size_t i = 0; i < samples / 10 + 1; ++i) {
+        for ( std::size_t j = 0; j < batch; ++j) {
+            fn();
+        }
+    }
+    std::vector< double > v;
+    v.reserve( samples);
+    for ( std::size_t i = 0; i < samples; ++i) {
+        time_point_type start( clock_type::now() );
+        for ( std::size_t j = 0; j < batch; ++j) {
+            fn();
+        }
+        duration_type total = clock_type::now() - start;
+        const double ns = static_cast< double >(
+                boost::chrono::duration_cast< boost::chrono::nanoseconds >( total).count() );
+        v.push_back( ( std::max)( ns - overhead, 0.) / batch);
+    }
+    return v;
+}
+
+// divides each sample by `n`, e.g. by the number of context switches per call
+inline
+std::vector< double > per( std::vector< double > v, std::size_t n) {
+    for ( double & d : v) {
+        d /= n;
+    }
+    return v;
+}
+
+inline
+result make_result( std::string scenario, std::string allocator, std::string unit,
+                    std::vector< double > samples) {
+    result r;
+    r.scenario = std::move( scenario);
+    r.allocator = std::move( allocator);
+    r.unit = std::move( unit);
+    r.stats = summarize( std::move( samples) );
+    return r;
+}
+
+inline
+void report_counters_text( std::ostream & os, std::vector< result > const& results) {
+    std::vector< std::string > names;
+    for ( result const& r : results) {
+        for ( std::pair< std::string, double > const& c : r.counters) {
+            if ( names.end() == std::find( names.begin(), names.end(), c.first) ) {
+                names.push_back( c.first);
+            }
+        }
+    }
+    if ( names.empty() ) {
+        return;
+    }
+    os << "\n" << std::left
+       << std::setw( 32) << "scenario"
+       << std::setw( 28) << "allocator"
+       << std::setw( 12) << "unit"
+       << std::right;
+    for ( std::string const& name : names) {
+        os << std::setw( 16) << name;
+    }
+    os << "\n";
+    os << std::fixed << std::setprecision( 3);
+    for ( result const& r : results) {
+        if ( r.counters.empty() ) {
+            continue;
+        }
+        os << std::left
+           << std::setw( 32) << r.scenario
+           << std::setw( 28) << r.allocator
+           << std::setw( 12) << r.unit
+           << std::right;
+        for ( std::string const& name : names) {
+            auto i = std::find_if( r.counters.begin(), r.counters.end(),
+                                   [&name]( std::pair< std::string, double > const& c){
+                                        return c.first == name;
+                                   });
+            if ( r.counters.end() != i) {
+                os << std::setw( 16) << i->second;
+            } else {
+                os << std::setw( 16) << "-";
+            }
+        }
+        os << "\n";
+    }
+}
+
+inline
+void report_text( std::ostream & os, std::vector< result > const& results) {
+    os << std::left
+       << std::setw( 32) << "scenario"
+       << std::setw( 28) << "allocator"
+       << std::setw( 12) << "unit"
+       << std::right
+       << std::setw( 10) << "min"
+       << std::setw( 10) << "p50"
+       << std::setw( 10) << "p90"
+       << std::setw( 10) << "p99"
+       << std::setw( 10) << "p99.9"
+       << std::setw( 10) << "max"
+       << std::setw( 10) << "mean"
+       << "\n";
+    os << std::fixed << std::setprecision( 1);
+    for ( result const& r : results) {
+        os << std::left
+           << std::setw( 32) << r.scenario
+           << std::setw( 28) << r.allocator
+           << std::setw( 12) << ( "ns/" + r.unit)
+           << std::right
+           << std::setw( 10) << r.stats.min
+           << std::setw( 10) << r.stats.p50
+           << std::setw( 10) << r.stats.p90
+           << std::setw( 10) << r.stats.p99
+           << std::setw( 10) << r.stats.p999
+           << std::setw( 10) << r.stats.max
+           << std::setw( 10) << r.stats.mean
+           << "\n";
+    }
+    report_counters_text( os, results);
+    os.flush();
+}
+
+inline
+std::string json_string( std::string const& str) {
+    std::ostringstream os;
+    os << '"';
+    for ( char c : str) {
+        switch ( c) {
+        case '"': os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n"; break;
+        case '\t': os << "\\t"; break;
+        default:
+            if ( static_cast< unsigned char >( c) < 0x20) {
+                os << "\\u" << std::hex << std::setw( 4) << std::setfill( '0') << static_cast< int >( c);
+            } else {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+    return os.str();
+}
+
+// `properties` describe the environment of the run (compiler, options ...)
+inline
+void report_json( std::ostream & os,
+                  std::vector< std::pair< std::string, std::string > > const& properties,
+                  std::vector< result > const& results) {
+    os << std::fixed << std::setprecision( 3);
+    os << "{\n  \"context\": {";
+    for ( std::size_t i = 0; i < properties.size(); ++i) {
+        os << ( 0 == i ? "\n" : ",\n")
+           << "    " << json_string( properties[i].first) << ": " << json_string( properties[i].second);
+    }
+    os << "\n  },\n  \"benchmarks\": [";
+    for ( std::size_t i = 0; i < results.size(); ++i) {
+        result const& r = results[i];
+        os << ( 0 == i ? "\n" : ",\n")
+           << "    {"
+           << " \"scenario\": " << json_string( r.scenario)
+           << ", \"allocator\": " << json_string( r.allocator)
+           << ", \"unit\": " << json_string( "ns/" + r.unit)
+           << ", \"samples\": " << r.stats.samples
+           << ", \"min\": " << r.stats.min
+           << ", \"p50\": " << r.stats.p50
+           << ", \"p90\": " << r.stats.p90
+           << ", \"p99\": " << r.stats.p99
+           << ", \"p999\": " << r.stats.p999
+           << ", \"max\": " << r.stats.max
+           << ", \"mean\": " << r.stats.mean;
+        if ( ! r.counters.empty() ) {
+            os << ", \"counters\": {";
+            for ( std::size_t j = 0; j < r.counters.size(); ++j) {
+                os << ( 0 == j ? " " : ", ")
+                   << json_string( r.counters[j].first) << ": " << r.counters[j].second;
+            }
+            os << " }";
+        }
+        os << " }";
+    }
+    os << "\n  ]\n}\n";
+    os.flush();
+}
+
+#endif // BENCH_H
@@ -0,0 +1,311 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// message passing between fibers: bounded_channel and unbounded_channel
+// (direct handoff, lock-free queue) versus a std::mutex protected queue
+// whose consumer is resumed explicitly
+//
+// latency: the main context sends a value to a fiber which returns it over
+//          a second queue; ns per round trip
+// mpsc/P:  P threads send `messages` values each to one consumer fiber;
+//          ns per message
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/context/channel.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/this_fiber.hpp>
+#include <boost/program_options.hpp>
+
+#include "../bench.hpp"
+
+namespace ctx = boost::context;
+
+std::size_t samples = 1000;
+std::size_t batch = 100;
+std::size_t capacity = 1024;
+std::size_t messages = 100000;
+std::size_t rounds = 10;
+std::vector< std::size_t > producers{ 1, 4 };
+std::vector< std::string > scenarios;
+std::vector< std::string > queues;
+
+bool selected( std::vector< std::string > const& filter, std::string const& name) {
+    return filter.empty() || filter.end() != std::find( filter.begin(), filter.end(), name);
+}
+
+// baseline: lock protected queue, the consumer is resumed (or notified) by the producer
+class mutex_queue {
+private:
+    std::mutex                  mtx_{};
+    std::condition_variable     cond_{};
+    std::deque< std::size_t >   queue_{};
+    bool                        closed_{ false };
+
+public:
+    void push( std::size_t v) {
+        {
+            std::unique_lock< std::mutex > lk{ mtx_ };
+            queue_.push_back( v);
+        }
+        cond_.notify_one();
+    }
+
+    bool try_pop( std::size_t & v) {
+        std::unique_lock< std::mutex > lk{ mtx_ };
+        if ( queue_.empty() ) {
+            return false;
+        }
+        v = queue_.front();
+        queue_.pop_front();
+        return true;
+    }
+
+    // blocks the thread
+    bool pop( std::size_t & v) {
+        std::unique_lock< std::mutex > lk{ mtx_ };
+        cond_.wait( lk, [this](){ return closed_ || ! queue_.empty(); });
+        if ( queue_.empty() ) {
+            return false;
+        }
+        v = queue_.front();
+        queue_.pop_front();
+        return true;
+    }
+
+    void close() {
+        {
+            std::unique_lock< std::mutex > lk{ mtx_ };
+            closed_ = true;
+        }
+        cond_.notify_all();
+    }
+};
+
+// fiber with the calling context as scheduler, runs until it parks
+template< typename Fn >
+ctx::fiber spawn( Fn fn) {
+    ctx::fiber f{ [fn]( ctx::fiber && sched) mutable {
+                ctx::this_fiber::set_scheduler( std::move( sched) );
+                fn();
+                return ctx::this_fiber::release_scheduler();
+            }};
+    do {
+        f = std::move( f).resume();
+    } while ( f);
+    return f;
+}
+
+template< typename Channel >
+void channel_latency( std::string const& name, Channel & request, Channel & response,
+                      std::vector< result > & results) {
+    // parks on `request`, runs inside of push()
+    spawn( [&request,&response](){
+                std::size_t v = 0;
+                while ( ctx::channel_op_status::success == request.pop( v) ) {
+                    response.push( v);
+                }
+            });
+    std::size_t i = 0;
+    results.push_back( make_result( "latency", name, "round-trip", measure( samples, batch, [&](){
+        std::size_t v = 0;
+        request.push( ++i);
+        response.try_pop( v);
+        BOOST_ASSERT( i == v);
+    }) ) );
+    // terminates the fiber
+    request.close();
+}
+
+void mutex_latency( std::vector< result > & results) {
+    mutex_queue request, response;
+    ctx::fiber f{ [&request,&response]( ctx::fiber && f) {
+                std::size_t v = 0;
+                while ( true) {
+                    while ( request.try_pop( v) ) {
+                        response.push( v);
+                    }
+                    f = std::move( f).resume();
+                }
+                return std::move( f);
+            }};
+    f = std::move( f).resume();
+    std::size_t i = 0;
+    results.push_back( make_result( "latency", "mutex_queue", "round-trip", measure( samples, batch, [&](){
+        std::size_t v = 0;
+        request.push( ++i);
+        f = std::move( f).resume();
+        response.try_pop( v);
+        BOOST_ASSERT( i == v);
+    }) ) );
+}
+
+template< typename Channel, typename ... Args >
+void channel_mpsc( std::string const& name, std::size_t p, std::vector< result > & results, Args ... args) {
+    results.push_back( make_result( "mpsc/" + std::to_string( p), name, "message", per( measure( rounds, 1, [&](){
+        Channel chan{ args ... };
+        std::atomic< std::size_t > count{ 0 };
+        // migrates to the thread of the producer that resumes it
+        spawn( [&chan,&count](){
+                    std::size_t v = 0, n = 0;
+                    while ( ctx::channel_op_status::success == chan.pop( v) ) {
+                        ++n;
+                    }
+                    count = n;
+                });
+        std::vector< std::thread > threads;
+        for ( std::size_t i = 0; i < p; ++i) {
+            threads.emplace_back( [&chan](){
+                    for ( std::size_t j = 0; j < messages; ++j) {
+                        chan.push( j);
+                    }
+                });
+        }
+        for ( std::thread & t : threads) {
+            t.join();
+        }
+        chan.close();
+        BOOST_ASSERT( p * messages == count);
+    }), p * messages) ) );
+}
+
+void mutex_mpsc( std::size_t p, std::vector< result > & results) {
+    results.push_back( make_result( "mpsc/" + std::to_string( p), "mutex_queue", "message", per( measure( rounds, 1, [&](){
+        mutex_queue queue;
+        std::size_t count = 0;
+        std::thread consumer{ [&queue,&count](){
+                    std::size_t v = 0;
+                    while ( queue.pop( v) ) {
+                        ++count;
+                    }
+                }};
+        std::vector< std::thread > threads;
+        for ( std::size_t i = 0; i < p; ++i) {
+            threads.emplace_back( [&queue](){
+                    for ( std::size_t j = 0; j < messages; ++j) {
+                        queue.push( j);
+                    }
+                });
+        }
+        for ( std::thread & t : threads) {
+            t.join();
+        }
+        queue.close();
+        consumer.join();
+        BOOST_ASSERT( p * messages == count);
+    }), p * messages) ) );
+}
+
+std::vector< std::pair< std::string, std::string > > properties() {
+    std::vector< std::pair< std::string, std::string > > p;
+    p.emplace_back( "compiler", BOOST_COMPILER);
+    p.emplace_back( "platform", BOOST_PLATFORM);
+    p.emplace_back( "hardware_concurrency", std::to_string( std::thread::hardware_concurrency() ) );
+    p.emplace_back( "capacity", std::to_string( capacity) );
+    p.emplace_back( "messages", std::to_string( messages) );
+    p.emplace_back( "samples", std::to_string( samples) );
+    p.emplace_back( "batch", std::to_string( batch) );
+    p.emplace_back( "rounds", std::to_string( rounds) );
+    return p;
+}
+
+int main( int argc, char * argv[]) {
+    try {
+        std::string format{ "text" };
+        boost::program_options::options_description desc("allowed options");
+        desc.add_options()
+            ("help", "help message")
+            ("samples,s", boost::program_options::value< std::size_t >( & samples), "samples of latency")
+            ("batch,b", boost::program_options::value< std::size_t >( & batch), "round trips per sample")
+            ("capacity", boost::program_options::value< std::size_t >( & capacity),
+             "capacity of bounded_channel (power of two)")
+            ("messages,m", boost::program_options::value< std::size_t >( & messages), "messages per producer in mpsc")
+            ("rounds,r", boost::program_options::value< std::size_t >( & rounds), "samples of mpsc")
+            ("producers,p", boost::program_options::value< std::vector< std::size_t > >( & producers)->multitoken(),
+             "number of producer threads in mpsc")
+            ("scenario", boost::program_options::value< std::vector< std::string > >( & scenarios)->multitoken(),
+             "latency, mpsc (default: all)")
+            ("queue", boost::program_options::value< std::vector< std::string > >( & queues)->multitoken(),
+             "bounded_channel, unbounded_channel, mutex_queue (default: all)")
+            ("format,f", boost::program_options::value< std::string >( & format), "output format: text or json");
+
+        boost::program_options::variables_map vm;
+        boost::program_options::store(
+                boost::program_options::parse_command_line(
+                    argc,
+                    argv,
+                    desc),
+                vm);
+        boost::program_options::notify( vm);
+
+        if ( vm.count("help") ) {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+        if ( 0 == samples || 0 == batch || 0 == messages || 0 == rounds) {
+            throw std::invalid_argument("samples, batch, messages and rounds must not be zero");
+        }
+        if ( "text" != format && "json" != format) {
+            throw std::invalid_argument("unknown format: " + format);
+        }
+        // see performance/suite
+        volatile double inexact = 1.;
+        inexact = inexact / 3.;
+
+        std::vector< result > results;
+        if ( selected( scenarios, "latency") ) {
+            if ( selected( queues, "bounded_channel") ) {
+                ctx::bounded_channel< std::size_t > request{ capacity }, response{ capacity };
+                channel_latency( "bounded_channel", request, response, results);
+            }
+            if ( selected( queues, "unbounded_channel") ) {
+                ctx::unbounded_channel< std::size_t > request, response;
+                channel_latency( "unbounded_channel", request, response, results);
+            }
+            if ( selected( queues, "mutex_queue") ) {
+                mutex_latency( results);
+            }
+        }
+        if ( selected( scenarios, "mpsc") ) {
+            for ( std::size_t p : producers) {
+                if ( selected( queues, "bounded_channel") ) {
+                    channel_mpsc< ctx::bounded_channel< std::size_t > >( "bounded_channel", p, results, capacity);
+                }
+                if ( selected( queues, "unbounded_channel") ) {
+                    channel_mpsc< ctx::unbounded_channel< std::size_t > >( "unbounded_channel", p, results);
+                }
+                if ( selected( queues, "mutex_queue") ) {
+                    mutex_mpsc( p, results);
+                }
+            }
+        }
+
+        if ( "json" == format) {
+            report_json( std::cout, properties(), results);
+        } else {
+            report_text( std::cout, results);
+        }
+
+        return EXIT_SUCCESS;
+    } catch ( std::exception const& e) {
+        std::cerr << "exception: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "unhandled exception" << std::endl;
+    }
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,221 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef COUNTERS_H
+#define COUNTERS_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+
+#if defined(__linux__)
+extern "C" {
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+}
+#endif
+
+// hardware performance counters of the calling thread, read via perf_event_open();
+// counts user space only (works with perf_event_paranoid <= 2),
+// counters the PMU/kernel does not provide are skipped
+
+struct counter_spec {
+    std::string     name;
+    std::uint32_t   type;
+    std::uint64_t   config;
+};
+
+#if defined(__linux__)
+inline
+std::vector< counter_spec > default_counters() {
+    const std::uint64_t l1d_read_miss =
+        PERF_COUNT_HW_CACHE_L1D |
+        ( PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    const std::uint64_t l1i_read_miss =
+        PERF_COUNT_HW_CACHE_L1I |
+        ( PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    return {
+        { "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { "instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { "branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { "L1d-misses", PERF_TYPE_HW_CACHE, l1d_read_miss },
+        { "L1i-misses", PERF_TYPE_HW_CACHE, l1i_read_miss } };
+}
+
+// raw, model specific event in the notation of perf-list: 'name=rUUEE'
+// (UU: umask, EE: event select), e.g. mispredicted returns
+//   Intel Skylake and later: ret-misses=r08c5 (BR_MISP_RETIRED.RET)
+//   AMD Zen:                 ret-misses=r00c9 (ex_ret_near_ret_mispred)
+inline
+counter_spec parse_raw_counter( std::string const& str) {
+    const std::string::size_type pos = str.find( '=');
+    if ( std::string::npos == pos || 0 == pos || str.size() < pos + 3 || 'r' != str[pos + 1]) {
+        throw std::invalid_argument("raw counter must be given as name=rXXXX: " + str);
+    }
+    char * end = nullptr;
+    const char * begin = str.c_str() + pos + 2;
+    const std::uint64_t config = std::strtoull( begin, & end, 16);
+    if ( '\0' != * end) {
+        throw std::invalid_argument("invalid raw counter: " + str);
+    }
+    return { str.substr( 0, pos), PERF_TYPE_RAW, config };
+}
+
+class counters {
+private:
+    struct counter {
+        std::string     name;
+        int             fd;
+    };
+
+    struct read_format {
+        std::uint64_t   value;
+        std::uint64_t   time_enabled;
+        std::uint64_t   time_running;
+    };
+
+    std::vector< counter >      counters_{};
+    std::vector< std::string >  errors_{};
+
+    static int open( counter_spec const& spec) noexcept {
+        ::perf_event_attr attr;
+        std::memset( & attr, 0, sizeof( attr) );
+        attr.size = sizeof( attr);
+        attr.type = spec.type;
+        attr.config = spec.config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // counters are multiplexed if the PMU has not enough of them
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        // calling thread, any CPU
+        return static_cast< int >( ::syscall( __NR_perf_event_open, & attr, 0, -1, -1, 0) );
+    }
+
+public:
+    explicit counters( std::vector< counter_spec > const& specs) {
+        for ( counter_spec const& spec : specs) {
+            const int fd = open( spec);
+            if ( -1 == fd) {
+                errors_.push_back( spec.name + ": " + std::strerror( errno) );
+            } else {
+                counters_.push_back( { spec.name, fd } );
+            }
+        }
+    }
+
+    ~counters() {
+        for ( counter & c : counters_) {
+            ::close( c.fd);
+        }
+    }
+
+    counters( counters const&) = delete;
+    counters & operator=( counters const&) = delete;
+
+    bool empty() const noexcept {
+        return counters_.empty();
+    }
+
+    // counters that could not be opened
+    std::vector< std::string > const& errors() const noexcept {
+        return errors_;
+    }
+
+    void start() noexcept {
+        for ( counter & c : counters_) {
+            ::ioctl( c.fd, PERF_EVENT_IOC_RESET, 0);
+        }
+        for ( counter & c : counters_) {
+            ::ioctl( c.fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    std::vector< std::pair< std::string, double > > stop() {
+        for ( counter & c : counters_) {
+            ::ioctl( c.fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+        std::vector< std::pair< std::string, double > > v;
+        for ( counter & c : counters_) {
+            read_format rf;
+            if ( sizeof( rf) != ::read( c.fd, & rf, sizeof( rf) ) || 0 == rf.time_running) {
+                // not scheduled on the PMU
+                continue;
+            }
+            // extrapolate if multiplexed
+            v.emplace_back( c.name,
+                            static_cast< double >( rf.value) * rf.time_enabled / rf.time_running);
+        }
+        return v;
+    }
+
+    // runs `iterations` calls of `fn`; returns the counts per operation,
+    // `n` operations (e.g. context switches) per call
+    template< typename Fn >
+    std::vector< std::pair< std::string, double > > count( std::size_t iterations, std::size_t n, Fn && fn) {
+        start();
+        for ( std::size_t i = 0; i < iterations; ++i) {
+            fn();
+        }
+        std::vector< std::pair< std::string, double > > v = stop();
+        for ( std::pair< std::string, double > & p : v) {
+            p.second /= static_cast< double >( iterations * n);
+        }
+        return v;
+    }
+};
+#else
+inline
+std::vector< counter_spec > default_counters() {
+    return {};
+}
+
+inline
+counter_spec parse_raw_counter( std::string const& str) {
+    throw std::invalid_argument("raw counters are not supported on this platform: " + str);
+}
+
+class counters {
+private:
+    std::vector< std::string >  errors_{};
+
+public:
+    explicit counters( std::vector< counter_spec > const& specs) {
+        if ( ! specs.empty() ) {
+            errors_.emplace_back( "hardware counters are not supported on this platform");
+        }
+    }
+
+    counters( counters const&) = delete;
+    counters & operator=( counters const&) = delete;
+
+    bool empty() const noexcept {
+        return true;
+    }
+
+    std::vector< std::string > const& errors() const noexcept {
+        return errors_;
+    }
+
+    template< typename Fn >
+    std::vector< std::pair< std::string, double > > count( std::size_t, std::size_t, Fn &&) {
+        return {};
+    }
+};
+#endif
+
+#endif // COUNTERS_H
@@ -0,0 +1,178 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// cost of a yield: fibers switching directly to the next ready fiber
+// (run_queue, one switch per yield) versus fibers returning to a scheduler
+// which resumes the next fiber (hub-and-spoke, two switches per yield)
+//
+// yield/N: N fibers yield `yields` times each, the scheduler resumes them
+//          round-robin until all terminated; ns per yield (creation and
+//          termination of the fibers amortized)
+//
+// hub:       minimal scheduler, a fiber yields by resuming the scheduler
+// nursery:   this_fiber::yield() to a nursery (spinlock protected queue)
+// run_queue: run_queue::yield(), the yielding fiber is queued on top of the
+//            next one (resume_with)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/nursery.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/run_queue.hpp>
+#include <boost/context/this_fiber.hpp>
+#include <boost/program_options.hpp>
+
+#include "../bench.hpp"
+
+namespace ctx = boost::context;
+
+std::size_t samples = 100;
+std::size_t batch = 1;
+std::size_t yields = 1000;
+std::size_t stack_size = 16 * 1024;
+std::vector< std::size_t > fibers{ 2, 16, 1024 };
+std::vector< std::string > schedulers;
+
+bool selected( std::vector< std::string > const& filter, std::string const& name) {
+    return filter.empty() || filter.end() != std::find( filter.begin(), filter.end(), name);
+}
+
+void hub( std::size_t n, ctx::pooled_fixedsize_stack & salloc) {
+    std::deque< ctx::fiber > ready;
+    for ( std::size_t i = 0; i < n; ++i) {
+        ready.emplace_back( std::allocator_arg, salloc, []( ctx::fiber && sched) {
+                    for ( std::size_t j = 0; j < yields; ++j) {
+                        sched = std::move( sched).resume();
+                    }
+                    return std::move( sched);
+                });
+    }
+    while ( ! ready.empty() ) {
+        ctx::fiber f = std::move( ready.front() );
+        ready.pop_front();
+        f = std::move( f).resume();
+        if ( f) {
+            ready.push_back( std::move( f) );
+        }
+    }
+}
+
+void nursery( std::size_t n, ctx::pooled_fixedsize_stack & salloc) {
+    ctx::nursery nr{ salloc };
+    for ( std::size_t i = 0; i < n; ++i) {
+        nr.spawn( [](){
+                    for ( std::size_t j = 0; j < yields; ++j) {
+                        ctx::this_fiber::yield();
+                    }
+                });
+    }
+    nr.join();
+}
+
+void run_queue( std::size_t n, ctx::pooled_fixedsize_stack & salloc) {
+    ctx::run_queue q{ salloc };
+    for ( std::size_t i = 0; i < n; ++i) {
+        q.spawn( [&q](){
+                    for ( std::size_t j = 0; j < yields; ++j) {
+                        q.yield();
+                    }
+                });
+    }
+    q.run();
+}
+
+template< typename Fn >
+void bench( std::string const& name, Fn && fn, std::vector< result > & results) {
+    if ( ! selected( schedulers, name) ) {
+        return;
+    }
+    ctx::pooled_fixedsize_stack salloc{ stack_size };
+    for ( std::size_t n : fibers) {
+        results.push_back( make_result( "yield/" + std::to_string( n), name, "yield",
+                                        per( measure( samples, batch, [&fn,&salloc,n](){
+            fn( n, salloc);
+        }), n * yields) ) );
+    }
+}
+
+std::vector< std::pair< std::string, std::string > > properties() {
+    std::vector< std::pair< std::string, std::string > > p;
+    p.emplace_back( "compiler", BOOST_COMPILER);
+    p.emplace_back( "platform", BOOST_PLATFORM);
+    p.emplace_back( "stack_size", std::to_string( stack_size) );
+    p.emplace_back( "samples", std::to_string( samples) );
+    p.emplace_back( "batch", std::to_string( batch) );
+    p.emplace_back( "yields", std::to_string( yields) );
+    return p;
+}
+
+int main( int argc, char * argv[]) {
+    try {
+        std::string format{ "text" };
+        boost::program_options::options_description desc("allowed options");
+        desc.add_options()
+            ("help", "help message")
+            ("samples,s", boost::program_options::value< std::size_t >( & samples), "samples per benchmark")
+            ("batch,b", boost::program_options::value< std::size_t >( & batch), "runs per sample")
+            ("yields,y", boost::program_options::value< std::size_t >( & yields), "yields per fiber")
+            ("stack-size", boost::program_options::value< std::size_t >( & stack_size), "stack size in bytes")
+            ("fibers,n", boost::program_options::value< std::vector< std::size_t > >( & fibers)->multitoken(),
+             "number of fibers")
+            ("scheduler", boost::program_options::value< std::vector< std::string > >( & schedulers)->multitoken(),
+             "hub, nursery, run_queue (default: all)")
+            ("format,f", boost::program_options::value< std::string >( & format), "output format: text or json");
+
+        boost::program_options::variables_map vm;
+        boost::program_options::store(
+                boost::program_options::parse_command_line(
+                    argc,
+                    argv,
+                    desc),
+                vm);
+        boost::program_options::notify( vm);
+
+        if ( vm.count("help") ) {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+        if ( 0 == samples || 0 == batch || 0 == yields) {
+            throw std::invalid_argument("samples, batch and yields must not be zero");
+        }
+        if ( "text" != format && "json" != format) {
+            throw std::invalid_argument("unknown format: " + format);
+        }
+        // see performance/suite
+        volatile double inexact = 1.;
+        inexact = inexact / 3.;
+
+        std::vector< result > results;
+        bench( "hub", hub, results);
+        bench( "nursery", nursery, results);
+        bench( "run_queue", run_queue, results);
+
+        if ( "json" == format) {
+            report_json( std::cout, properties(), results);
+        } else {
+            report_text( std::cout, results);
+        }
+
+        return EXIT_SUCCESS;
+    } catch ( std::exception const& e) {
+        std::cerr << "exception: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "unhandled exception" << std::endl;
+    }
+    return EXIT_FAILURE;
+}
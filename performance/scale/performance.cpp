@@ -0,0 +1,373 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// behaviour with a large number of simultaneously suspended fibers:
+// memory and mappings per fiber, creation and destruction throughput,
+// latency of resuming a randomly chosen fiber
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/fixedsize_stack.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/preallocated.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
+#include <boost/context/stack_traits.hpp>
+#include <boost/program_options.hpp>
+
+#if defined(BOOST_POSIX_API) || defined(__unix__)
+extern "C" {
+#include <sys/mman.h>
+#include <unistd.h>
+}
+#endif
+
+#include "../bench.hpp"
+
+namespace ctx = boost::context;
+
+std::size_t count = 1000000;
+std::size_t stack_size = 16 * 1024;
+std::size_t samples = 1000;
+std::size_t batch = 100;
+std::vector< std::string > allocators;
+
+// mappings left to the rest of the process (heap, libraries ...)
+constexpr std::ptrdiff_t reserved_mappings = 1024;
+
+struct scale_result {
+    std::string     allocator;
+    // fibers created; less than `count` if the allocator failed or was limited
+    std::size_t     fibers{ 0 };
+    std::string     error{};
+    // fibers per second (created and suspended; unwound and destroyed)
+    double          create_rate{ 0 };
+    double          destroy_rate{ 0 };
+    // resident memory and mappings attributed to the fibers
+    double          rss_per_fiber{ 0 };
+    std::ptrdiff_t  vmas{ 0 };
+    // resume of a random fiber (switch to it and back)
+    summary         resume{};
+};
+
+bool selected( std::string const& name) {
+    return allocators.empty() || allocators.end() != std::find( allocators.begin(), allocators.end(), name);
+}
+
+// resident set size in bytes, 0 if unknown
+std::size_t resident() {
+    std::ifstream statm{ "/proc/self/statm" };
+    std::size_t size = 0, rss = 0;
+    if ( ! ( statm >> size >> rss) ) {
+        return 0;
+    }
+    return rss * ctx::stack_traits::page_size();
+}
+
+// number of memory mappings, 0 if unknown
+std::ptrdiff_t mappings() {
+    std::ifstream maps{ "/proc/self/maps" };
+    std::ptrdiff_t n = 0;
+    std::string line;
+    while ( std::getline( maps, line) ) {
+        ++n;
+    }
+    return n;
+}
+
+// limit of memory mappings per process, 0 if unknown
+std::ptrdiff_t max_mappings() {
+    std::ifstream max_map_count{ "/proc/sys/vm/max_map_count" };
+    std::ptrdiff_t n = 0;
+    if ( ! ( max_map_count >> n) ) {
+        return 0;
+    }
+    return n;
+}
+
+double seconds( duration_type d) {
+    return boost::chrono::duration_cast< boost::chrono::duration< double > >( d).count();
+}
+
+static ctx::fiber suspended( ctx::fiber && f) {
+    while ( true) {
+        f = std::move( f).resume();
+    }
+    return std::move( f);
+}
+
+// `make` creates the i-th of `n` fibers
+template< typename Make >
+scale_result scale( std::string const& name, std::size_t n, Make && make) {
+    scale_result r;
+    r.allocator = name;
+    const std::size_t rss0 = resident();
+    const std::ptrdiff_t vmas0 = mappings();
+    std::vector< ctx::fiber > v;
+    v.reserve( n);
+    time_point_type start( clock_type::now() );
+    try {
+        for ( std::size_t i = 0; i < n; ++i) {
+            v.push_back( make( i) );
+            // suspended inside its context-function
+            v.back() = std::move( v.back() ).resume();
+        }
+    } catch ( std::exception const& e) {
+        r.error = e.what();
+    }
+    r.create_rate = v.size() / seconds( clock_type::now() - start);
+    r.fibers = v.size();
+    if ( v.empty() ) {
+        return r;
+    }
+    r.rss_per_fiber = ( static_cast< double >( resident() ) - rss0) / v.size();
+    r.vmas = mappings() - vmas0;
+
+    std::minstd_rand generator{ 42 };
+    std::uniform_int_distribution< std::size_t > distribution{ 0, v.size() - 1 };
+    std::vector< std::size_t > indices( ( samples / 10 + 1 + samples) * batch);
+    for ( std::size_t & idx : indices) {
+        idx = distribution( generator);
+    }
+    std::size_t next = 0;
+    r.resume = summarize( measure( samples, batch, [&v,&indices,&next](){
+        ctx::fiber & f = v[indices[next++]];
+        f = std::move( f).resume();
+    }) );
+
+    start = clock_type::now();
+    // unwinds the stacks of the suspended fibers
+    v.clear();
+    r.destroy_rate = r.fibers / seconds( clock_type::now() - start);
+    return r;
+}
+
+#if defined(BOOST_POSIX_API) || defined(__unix__)
+// one mapping for all stacks, handed out as preallocated stacks
+class arena {
+private:
+    void            *   vp_;
+    std::size_t         size_;
+
+public:
+    arena( std::size_t n, std::size_t stack_size) :
+        vp_{ nullptr },
+        size_{ n * stack_size } {
+        vp_ = ::mmap( nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+        if ( MAP_FAILED == vp_) {
+            throw std::bad_alloc();
+        }
+    }
+
+    ~arena() {
+        ::munmap( vp_, size_);
+    }
+
+    arena( arena const&) = delete;
+    arena & operator=( arena const&) = delete;
+
+    ctx::stack_context at( std::size_t i) const noexcept {
+        ctx::stack_context sctx;
+        sctx.size = stack_size;
+        sctx.sp = static_cast< char * >( vp_) + ( i + 1) * stack_size;
+        return sctx;
+    }
+};
+
+// the memory of the stack is owned by the arena
+struct arena_stack {
+    ctx::stack_context allocate() {
+        throw std::bad_alloc();
+    }
+
+    void deallocate( ctx::stack_context &) noexcept {
+    }
+};
+#endif
+
+void report_text( std::ostream & os, std::vector< scale_result > const& results) {
+    os << std::left
+       << std::setw( 28) << "allocator"
+       << std::right
+       << std::setw( 10) << "fibers"
+       << std::setw( 14) << "create/s"
+       << std::setw( 14) << "destroy/s"
+       << std::setw( 12) << "RSS/fiber"
+       << std::setw( 10) << "VMAs"
+       << std::setw( 12) << "resume p50"
+       << std::setw( 12) << "p99"
+       << std::setw( 12) << "p99.9"
+       << "\n";
+    os << std::fixed << std::setprecision( 0);
+    for ( scale_result const& r : results) {
+        os << std::left
+           << std::setw( 28) << r.allocator
+           << std::right
+           << std::setw( 10) << r.fibers
+           << std::setw( 14) << r.create_rate
+           << std::setw( 14) << r.destroy_rate
+           << std::setw( 12) << r.rss_per_fiber
+           << std::setw( 10) << r.vmas
+           << std::setprecision( 1)
+           << std::setw( 12) << r.resume.p50
+           << std::setw( 12) << r.resume.p99
+           << std::setw( 12) << r.resume.p999
+           << std::setprecision( 0)
+           << "\n";
+        if ( ! r.error.empty() ) {
+            os << "  stopped after " << r.fibers << " fibers: " << r.error << "\n";
+        }
+        if ( 0 < max_mappings() && max_mappings() <= r.vmas + reserved_mappings) {
+            // protected_fixedsize_stack: mprotect() of the guard page fails
+            os << "  reached vm.max_map_count (" << max_mappings() << "), stacks might lack guard pages\n";
+        }
+    }
+    os << "(RSS in bytes, resume in ns)" << std::endl;
+}
+
+void report_json( std::ostream & os, std::vector< scale_result > const& results) {
+    os << std::fixed << std::setprecision( 3);
+    os << "{\n  \"context\": {"
+       << "\n    \"compiler\": " << json_string( BOOST_COMPILER)
+       << ",\n    \"platform\": " << json_string( BOOST_PLATFORM)
+       << ",\n    \"count\": " << count
+       << ",\n    \"stack_size\": " << stack_size
+       << ",\n    \"max_map_count\": " << max_mappings()
+       << "\n  },\n  \"benchmarks\": [";
+    for ( std::size_t i = 0; i < results.size(); ++i) {
+        scale_result const& r = results[i];
+        os << ( 0 == i ? "\n" : ",\n")
+           << "    {"
+           << " \"allocator\": " << json_string( r.allocator)
+           << ", \"fibers\": " << r.fibers
+           << ", \"error\": " << json_string( r.error)
+           << ", \"create_per_second\": " << r.create_rate
+           << ", \"destroy_per_second\": " << r.destroy_rate
+           << ", \"rss_per_fiber\": " << r.rss_per_fiber
+           << ", \"vmas\": " << r.vmas
+           << ", \"resume\": { \"unit\": \"ns\""
+           << ", \"min\": " << r.resume.min
+           << ", \"p50\": " << r.resume.p50
+           << ", \"p90\": " << r.resume.p90
+           << ", \"p99\": " << r.resume.p99
+           << ", \"p999\": " << r.resume.p999
+           << ", \"max\": " << r.resume.max
+           << ", \"mean\": " << r.resume.mean
+           << " } }";
+    }
+    os << "\n  ]\n}\n";
+    os.flush();
+}
+
+int main( int argc, char * argv[]) {
+    try {
+        std::string format{ "text" };
+        boost::program_options::options_description desc("allowed options");
+        desc.add_options()
+            ("help", "help message")
+            ("fibers,n", boost::program_options::value< std::size_t >( & count), "number of fibers")
+            ("stack-size", boost::program_options::value< std::size_t >( & stack_size), "stack size in bytes")
+            ("samples,s", boost::program_options::value< std::size_t >( & samples), "samples of resume latency")
+            ("batch,b", boost::program_options::value< std::size_t >( & batch), "resumes per sample")
+            ("allocator", boost::program_options::value< std::vector< std::string > >( & allocators)->multitoken(),
+             "fixedsize_stack, protected_fixedsize_stack, pooled_fixedsize_stack, preallocated (default: all)")
+            ("format,f", boost::program_options::value< std::string >( & format), "output format: text or json");
+
+        boost::program_options::variables_map vm;
+        boost::program_options::store(
+                boost::program_options::parse_command_line(
+                    argc,
+                    argv,
+                    desc),
+                vm);
+        boost::program_options::notify( vm);
+
+        if ( vm.count("help") ) {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+        if ( 0 == count || 0 == samples || 0 == batch) {
+            throw std::invalid_argument("fibers, samples and batch must not be zero");
+        }
+        if ( "text" != format && "json" != format) {
+            throw std::invalid_argument("unknown format: " + format);
+        }
+        // see performance/suite
+        volatile double inexact = 1.;
+        inexact = inexact / 3.;
+
+        std::vector< scale_result > results;
+        if ( selected( "fixedsize_stack") ) {
+            ctx::fixedsize_stack salloc{ stack_size };
+            results.push_back( scale( "fixedsize_stack", count, [&salloc]( std::size_t){
+                return ctx::fiber{ std::allocator_arg, salloc, suspended };
+            }) );
+        }
+        if ( selected( "protected_fixedsize_stack") ) {
+            // two mappings per stack (guard page and stack); beyond vm.max_map_count
+            // mprotect() and munmap() fail, leaking stacks and mappings
+            std::size_t n = count;
+            const std::ptrdiff_t available = max_mappings() - mappings() - reserved_mappings;
+            if ( 0 < max_mappings() && static_cast< std::ptrdiff_t >( 2 * n) > available) {
+                n = 0 < available ? available / 2 : 0;
+            }
+            ctx::protected_fixedsize_stack salloc{ stack_size };
+            scale_result r = scale( "protected_fixedsize_stack", n, [&salloc]( std::size_t){
+                return ctx::fiber{ std::allocator_arg, salloc, suspended };
+            });
+            if ( n < count && r.error.empty() ) {
+                r.error = "limited by vm.max_map_count (" + std::to_string( max_mappings() ) + ")";
+            }
+            results.push_back( r);
+        }
+        if ( selected( "pooled_fixedsize_stack") ) {
+            ctx::pooled_fixedsize_stack salloc{ stack_size };
+            results.push_back( scale( "pooled_fixedsize_stack", count, [&salloc]( std::size_t){
+                return ctx::fiber{ std::allocator_arg, salloc, suspended };
+            }) );
+        }
+#if defined(BOOST_POSIX_API) || defined(__unix__)
+        if ( selected( "preallocated") ) {
+            std::unique_ptr< arena > a;
+            results.push_back( scale( "preallocated", count, [&a]( std::size_t i){
+                if ( ! a) {
+                    // mapped inside the measurement
+                    a.reset( new arena{ count, stack_size });
+                }
+                ctx::stack_context sctx = a->at( i);
+                return ctx::fiber{ std::allocator_arg, ctx::preallocated( sctx.sp, sctx.size, sctx),
+                                   arena_stack{}, suspended };
+            }) );
+        }
+#endif
+
+        if ( "json" == format) {
+            report_json( std::cout, results);
+        } else {
+            report_text( std::cout, results);
+        }
+
+        return EXIT_SUCCESS;
+    } catch ( std::exception const& e) {
+        std::cerr << "exception: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "unhandled exception" << std::endl;
+    }
+    return EXIT_FAILURE;
+}
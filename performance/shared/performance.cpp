@@ -0,0 +1,262 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// fibers on private stacks (pooled_fixedsize_stack) versus fibers sharing one
+// stack (shared_stack, stack-copying) - cost of a resume and memory retained
+// per suspended fiber, depending on the stack usage of the fibers
+//
+// round-robin/N/D: N fibers, suspended with D bytes of frames on their stacks,
+//                  are resumed in turn (each resume of a shared_fiber saves
+//                  the stack of its predecessor and restores its own);
+//                  ns per resume (round trip)
+// ping-pong/D:     one fiber resumed repeatedly, nothing is copied
+// footprint:       memory retained per suspended fiber - shared_fiber: handle
+//                  and copy of the used stack; private: the used stack rounded
+//                  up to pages (resident), `stack-size` is reserved
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/shared_stack.hpp>
+#include <boost/context/stack_traits.hpp>
+#include <boost/program_options.hpp>
+
+#include "../bench.hpp"
+
+namespace ctx = boost::context;
+
+// bytes of one frame of descend()
+constexpr std::size_t frame_size = 256;
+
+std::size_t samples = 100;
+std::size_t batch = 10;
+std::size_t stack_size = 64 * 1024;
+std::vector< std::size_t > fibers{ 1024 };
+std::vector< std::size_t > depths{ 256, 1024, 4096, 16384 };
+std::vector< std::string > scenarios;
+std::vector< std::string > stacks;
+
+bool selected( std::vector< std::string > const& filter, std::string const& name) {
+    return filter.empty() || filter.end() != std::find( filter.begin(), filter.end(), name);
+}
+
+volatile std::size_t sink = 0;
+
+// suspends repeatedly below `n` frames of `frame_size` bytes
+BOOST_NOINLINE
+void descend( ctx::fiber & caller, std::size_t n) {
+    volatile char buffer[frame_size];
+    buffer[0] = static_cast< char >( n);
+    if ( 0 == n) {
+        while ( caller) {
+            caller = std::move( caller).resume();
+        }
+        return;
+    }
+    descend( caller, n - 1);
+    sink = buffer[0];
+}
+
+ctx::fiber loop( ctx::fiber && caller, std::size_t depth) {
+    descend( caller, depth / frame_size);
+    return std::move( caller);
+}
+
+struct footprint {
+    std::size_t     depth;
+    // bytes of the stack used by a suspended fiber
+    std::size_t     usage;
+    std::size_t     shared;
+    std::size_t     resident;
+};
+
+std::vector< footprint > footprints;
+
+std::size_t page_round( std::size_t size) {
+    const std::size_t page = ctx::stack_traits::page_size();
+    return ( size + page - 1) / page * page;
+}
+
+void private_stacks( std::size_t n, std::size_t depth, std::vector< result > & results) {
+    ctx::pooled_fixedsize_stack salloc{ stack_size };
+    std::vector< ctx::fiber > v;
+    v.reserve( n);
+    for ( std::size_t i = 0; i < n; ++i) {
+        v.emplace_back( std::allocator_arg, salloc, [depth]( ctx::fiber && caller) {
+                    return loop( std::move( caller), depth);
+                });
+        v.back() = std::move( v.back() ).resume();
+    }
+    if ( selected( scenarios, "round-robin") ) {
+        results.push_back( make_result( "round-robin/" + std::to_string( n) + "/" + std::to_string( depth),
+                                        "private", "resume", per( measure( samples, batch, [&v](){
+            for ( ctx::fiber & f : v) {
+                f = std::move( f).resume();
+            }
+        }), v.size() ) ) );
+    }
+    if ( selected( scenarios, "ping-pong") ) {
+        results.push_back( make_result( "ping-pong/" + std::to_string( depth), "private", "resume",
+                                        measure( samples, batch * 100, [&v](){
+            v.front() = std::move( v.front() ).resume();
+        }) ) );
+    }
+}
+
+void shared_stacks( std::size_t n, std::size_t depth, std::vector< result > & results) {
+    ctx::shared_stack stack{ stack_size };
+    std::vector< ctx::shared_fiber > v;
+    v.reserve( n);
+    for ( std::size_t i = 0; i < n; ++i) {
+        v.emplace_back( stack, [depth]( ctx::fiber && caller) {
+                    return loop( std::move( caller), depth);
+                });
+        v.back().resume();
+    }
+    if ( selected( scenarios, "round-robin") ) {
+        results.push_back( make_result( "round-robin/" + std::to_string( n) + "/" + std::to_string( depth),
+                                        "shared", "resume", per( measure( samples, batch, [&v](){
+            for ( ctx::shared_fiber & f : v) {
+                f.resume();
+            }
+        }), v.size() ) ) );
+    }
+    if ( selected( scenarios, "ping-pong") ) {
+        results.push_back( make_result( "ping-pong/" + std::to_string( depth), "shared", "resume",
+                                        measure( samples, batch * 100, [&v](){
+            v.front().resume();
+        }) ) );
+    }
+    if ( selected( scenarios, "footprint") &&
+         footprints.end() == std::find_if( footprints.begin(), footprints.end(),
+                                           [depth]( footprint const& fp){ return depth == fp.depth; }) ) {
+        // evicted by v.front()
+        v.front().resume();
+        footprint fp;
+        fp.depth = depth;
+        fp.usage = v.back().stack_usage();
+        fp.shared = sizeof( ctx::shared_fiber) + v.back().capacity();
+        fp.resident = page_round( fp.usage);
+        footprints.push_back( fp);
+    }
+    // unwinds the fibers, the resident one last
+    while ( ! v.empty() ) {
+        v.pop_back();
+    }
+}
+
+std::vector< std::pair< std::string, std::string > > properties() {
+    std::vector< std::pair< std::string, std::string > > p;
+    p.emplace_back( "compiler", BOOST_COMPILER);
+    p.emplace_back( "platform", BOOST_PLATFORM);
+    p.emplace_back( "stack_size", std::to_string( stack_size) );
+    p.emplace_back( "samples", std::to_string( samples) );
+    p.emplace_back( "batch", std::to_string( batch) );
+    for ( footprint const& fp : footprints) {
+        const std::string prefix = "footprint/" + std::to_string( fp.depth) + "/";
+        p.emplace_back( prefix + "usage", std::to_string( fp.usage) );
+        p.emplace_back( prefix + "shared", std::to_string( fp.shared) );
+        p.emplace_back( prefix + "private", std::to_string( fp.resident) );
+    }
+    return p;
+}
+
+int main( int argc, char * argv[]) {
+    try {
+        std::string format{ "text" };
+        boost::program_options::options_description desc("allowed options");
+        desc.add_options()
+            ("help", "help message")
+            ("samples,s", boost::program_options::value< std::size_t >( & samples), "samples per benchmark")
+            ("batch,b", boost::program_options::value< std::size_t >( & batch), "rounds per sample")
+            ("stack-size", boost::program_options::value< std::size_t >( & stack_size),
+             "size of the private stacks and of the shared stack")
+            ("fibers,n", boost::program_options::value< std::vector< std::size_t > >( & fibers)->multitoken(),
+             "number of fibers")
+            ("depth,d", boost::program_options::value< std::vector< std::size_t > >( & depths)->multitoken(),
+             "bytes of frames on the stack of a suspended fiber")
+            ("scenario", boost::program_options::value< std::vector< std::string > >( & scenarios)->multitoken(),
+             "round-robin, ping-pong, footprint (default: all)")
+            ("stack", boost::program_options::value< std::vector< std::string > >( & stacks)->multitoken(),
+             "private, shared (default: all)")
+            ("format,f", boost::program_options::value< std::string >( & format), "output format: text or json");
+
+        boost::program_options::variables_map vm;
+        boost::program_options::store(
+                boost::program_options::parse_command_line(
+                    argc,
+                    argv,
+                    desc),
+                vm);
+        boost::program_options::notify( vm);
+
+        if ( vm.count("help") ) {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+        if ( 0 == samples || 0 == batch) {
+            throw std::invalid_argument("samples and batch must not be zero");
+        }
+        for ( std::size_t depth : depths) {
+            // frames, control structure and the context-function
+            if ( stack_size < depth + 16 * 1024) {
+                throw std::invalid_argument("depth " + std::to_string( depth) + " does not fit into the stack");
+            }
+        }
+        if ( "text" != format && "json" != format) {
+            throw std::invalid_argument("unknown format: " + format);
+        }
+        // see performance/suite
+        volatile double inexact = 1.;
+        inexact = inexact / 3.;
+
+        std::vector< result > results;
+        for ( std::size_t n : fibers) {
+            for ( std::size_t depth : depths) {
+                if ( selected( stacks, "private") ) {
+                    private_stacks( n, depth, results);
+                }
+                if ( selected( stacks, "shared") ) {
+                    shared_stacks( n, depth, results);
+                }
+            }
+        }
+
+        if ( "json" == format) {
+            report_json( std::cout, properties(), results);
+        } else {
+            report_text( std::cout, results);
+            if ( ! footprints.empty() ) {
+                std::cout << "\nbytes per suspended fiber (private: resident, " << stack_size << " reserved)\n";
+                std::cout << "depth     usage    shared   private\n";
+                for ( footprint const& fp : footprints) {
+                    std::cout << std::left
+                              << std::setw( 10) << fp.depth
+                              << std::setw( 9) << fp.usage
+                              << std::setw( 10) << fp.shared
+                              << fp.resident << "\n";
+                }
+            }
+        }
+
+        return EXIT_SUCCESS;
+    } catch ( std::exception const& e) {
+        std::cerr << "exception: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "unhandled exception" << std::endl;
+    }
+    return EXIT_FAILURE;
+}
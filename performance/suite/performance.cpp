@@ -0,0 +1,431 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/context/continuation.hpp>
+#include <boost/context/detail/fcontext.hpp>
+#include <boost/context/detail/record_layout.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/fixedsize_stack.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
+#if defined(BOOST_USE_SEGMENTED_STACKS)
+#include <boost/context/segmented_stack.hpp>
+#endif
+#include <boost/context/stack_traits.hpp>
+#include <boost/program_options.hpp>
+
+#include "../bench.hpp"
+#include "../counters.hpp"
+
+namespace ctx = boost::context;
+
+// upper limit of the working set a fiber touches on its stack per resume
+constexpr std::size_t max_touch = 4 * 1024;
+
+std::size_t samples = 1000;
+std::size_t batch = 100;
+std::size_t stack_size = ctx::stack_traits::default_size();
+std::size_t touch = 256;
+std::size_t depth = 16;
+std::vector< std::size_t > fibers{ 16, 1024 };
+std::vector< std::string > scenarios;
+std::vector< std::string > allocators;
+// hardware counters, nullptr if disabled
+counters * hw = nullptr;
+
+bool selected( std::vector< std::string > const& filter, std::string const& name) {
+    return filter.empty() || filter.end() != std::find( filter.begin(), filter.end(), name);
+}
+
+// times `fn` and, if enabled, reads the hardware counters over the same workload;
+// `n` operations (`unit`) per call of `fn`
+template< typename Fn >
+result bench( std::string scenario, std::string const& name, std::string unit,
+              std::size_t b, std::size_t n, Fn && fn) {
+    result r = make_result( std::move( scenario), name, std::move( unit),
+                            per( measure( samples, b, fn), n) );
+    if ( nullptr != hw) {
+        r.counters = hw->count( samples * b, n, fn);
+    }
+    return r;
+}
+
+// fcontext_t
+
+static void fcontext_loop( ctx::detail::transfer_t t) {
+    while ( true) {
+        t = ctx::detail::jump_fcontext( t.fctx, nullptr);
+    }
+}
+
+template< typename StackAlloc >
+void fcontext_ping_pong( std::string const& name, StackAlloc salloc, std::vector< result > & results) {
+    ctx::stack_context sctx = salloc.allocate();
+    ctx::detail::fcontext_t fctx = ctx::detail::make_fcontext( sctx.sp, sctx.size, fcontext_loop);
+    // cache warm-up
+    fctx = ctx::detail::jump_fcontext( fctx, nullptr).fctx;
+    results.push_back( bench( "fcontext ping-pong", name, "switch", batch, 2, [&fctx](){
+        fctx = ctx::detail::jump_fcontext( fctx, nullptr).fctx;
+    }) );
+    // the loop never terminates, its stack is released in suspended state
+    salloc.deallocate( sctx);
+}
+
+// fiber
+
+static ctx::fiber fiber_loop( ctx::fiber && f) {
+    while ( true) {
+        f = std::move( f).resume();
+    }
+    return std::move( f);
+}
+
+template< typename StackAlloc >
+void fiber_ping_pong( std::string const& name, StackAlloc salloc, std::vector< result > & results) {
+    ctx::fiber f{ std::allocator_arg, salloc, fiber_loop };
+    // cache warm-up
+    f = std::move( f).resume();
+    results.push_back( bench( "fiber ping-pong", name, "switch", batch, 2, [&f](){
+        f = std::move( f).resume();
+    }) );
+}
+
+template< typename StackAlloc >
+void fiber_resume_with( std::string const& name, StackAlloc salloc, std::vector< result > & results) {
+    ctx::fiber f{ std::allocator_arg, salloc, fiber_loop };
+    // cache warm-up
+    f = std::move( f).resume();
+    results.push_back( bench( "fiber resume_with", name, "switch", batch, 2, [&f](){
+        f = std::move( f).resume_with( []( ctx::fiber && f){
+                    return std::move( f);
+                });
+    }) );
+}
+
+volatile std::size_t sink = 0;
+
+// descends `n` frames before switching, returns through them after resumed;
+// stresses the return stack buffer of the CPU
+BOOST_NOINLINE
+void descend( ctx::fiber & f, std::size_t n) {
+    if ( 0 == n) {
+        f = std::move( f).resume();
+    } else {
+        descend( f, n - 1);
+    }
+    // no tail call
+    sink = n;
+}
+
+static ctx::fiber fiber_deep_loop( ctx::fiber && f) {
+    while ( true) {
+        descend( f, depth);
+    }
+    return std::move( f);
+}
+
+// both sides switch at the bottom of a call chain of `depth` frames
+template< typename StackAlloc >
+void fiber_deep( std::string const& name, StackAlloc salloc, std::vector< result > & results) {
+    ctx::fiber f{ std::allocator_arg, salloc, fiber_deep_loop };
+    // cache warm-up
+    f = std::move( f).resume();
+    results.push_back( bench( "fiber deep/" + std::to_string( depth), name, "switch", batch, 2, [&f](){
+        descend( f, depth);
+    }) );
+}
+
+// touches `touch` bytes of its own stack each time it is resumed
+static ctx::fiber fiber_touch_loop( ctx::fiber && f) {
+    char buffer[max_touch];
+    std::memset( buffer, 0, sizeof( buffer) );
+    volatile char * p = buffer;
+    while ( true) {
+        for ( std::size_t i = 0; i < touch; i += cacheline_length) {
+            p[i] = p[i] + 1;
+        }
+        f = std::move( f).resume();
+    }
+    return std::move( f);
+}
+
+// the working set of all fibers exceeds L1/L2 for large `n`
+template< typename StackAlloc >
+void fiber_round_robin( std::string const& name, StackAlloc salloc, std::size_t n, std::vector< result > & results) {
+    std::vector< ctx::fiber > v;
+    v.reserve( n);
+    for ( std::size_t i = 0; i < n; ++i) {
+        v.emplace_back( std::allocator_arg, salloc, fiber_touch_loop);
+    }
+    // start fibers
+    for ( ctx::fiber & f : v) {
+        f = std::move( f).resume();
+    }
+    results.push_back( bench( "fiber round-robin/" + std::to_string( n), name, "switch", 1, 2 * n, [&v](){
+        for ( ctx::fiber & f : v) {
+            f = std::move( f).resume();
+        }
+    }) );
+}
+
+// resumes `n` fibers that switch back immediately; for large `n` the lines
+// at the stack tops (control structure, context-data) are cold on each resume
+template< typename StackAlloc >
+void fiber_cold( std::string const& name, StackAlloc salloc, std::size_t n, std::vector< result > & results) {
+    std::vector< ctx::fiber > v;
+    v.reserve( n);
+    for ( std::size_t i = 0; i < n; ++i) {
+        v.emplace_back( std::allocator_arg, salloc, fiber_loop);
+    }
+    for ( ctx::fiber & f : v) {
+        f = std::move( f).resume();
+    }
+    results.push_back( bench( "fiber cold-resume/" + std::to_string( n), name, "switch", 1, 2 * n, [&v](){
+        for ( ctx::fiber & f : v) {
+            f = std::move( f).resume();
+        }
+    }) );
+}
+
+// as fiber_cold but the next fiber is prefetched one switch ahead
+template< typename StackAlloc >
+void fiber_prefetch( std::string const& name, StackAlloc salloc, std::size_t n, std::vector< result > & results) {
+    std::vector< ctx::fiber > v;
+    v.reserve( n);
+    for ( std::size_t i = 0; i < n; ++i) {
+        v.emplace_back( std::allocator_arg, salloc, fiber_loop);
+    }
+    for ( ctx::fiber & f : v) {
+        f = std::move( f).resume();
+    }
+    results.push_back( bench( "fiber prefetch-resume/" + std::to_string( n), name, "switch", 1, 2 * n, [&v](){
+        const std::size_t n = v.size();
+        for ( std::size_t i = 0; i < n; ++i) {
+            v[i + 1 < n ? i + 1 : 0].prefetch();
+            v[i] = std::move( v[i]).resume();
+        }
+    }) );
+}
+
+template< typename StackAlloc >
+void fiber_create( std::string const& name, StackAlloc salloc, std::vector< result > & results) {
+    results.push_back( bench( "fiber create+destroy", name, "fiber", batch, 1, [&salloc](){
+        ctx::fiber f{ std::allocator_arg, salloc,
+                      []( ctx::fiber && f){
+                          return std::move( f);
+                      }};
+        // runs to completion, stack is deallocated
+        f = std::move( f).resume();
+    }) );
+}
+
+template< typename StackAlloc >
+void fiber_unwind( std::string const& name, StackAlloc salloc, std::vector< result > & results) {
+    results.push_back( bench( "fiber create+unwind", name, "fiber", batch, 1, [&salloc](){
+        ctx::fiber f{ std::allocator_arg, salloc,
+                      []( ctx::fiber && f){
+                          f = std::move( f).resume();
+                          return std::move( f);
+                      }};
+        f = std::move( f).resume();
+        // destructor unwinds the suspended fiber
+    }) );
+}
+
+// continuation
+
+static ctx::continuation continuation_loop( ctx::continuation && c) {
+    while ( true) {
+        c = c.resume();
+    }
+    return std::move( c);
+}
+
+template< typename StackAlloc >
+void continuation_ping_pong( std::string const& name, StackAlloc salloc, std::vector< result > & results) {
+    // cache warm-up
+    ctx::continuation c = ctx::callcc( std::allocator_arg, salloc, continuation_loop);
+    results.push_back( bench( "continuation ping-pong", name, "switch", batch, 2, [&c](){
+        c = c.resume();
+    }) );
+}
+
+template< typename StackAlloc >
+void run( std::string const& name, StackAlloc salloc, std::vector< result > & results) {
+    if ( ! selected( allocators, name) ) {
+        return;
+    }
+    if ( selected( scenarios, "fcontext") ) {
+        fcontext_ping_pong( name, salloc, results);
+    }
+    if ( selected( scenarios, "fiber") ) {
+        fiber_ping_pong( name, salloc, results);
+    }
+    if ( selected( scenarios, "resume_with") ) {
+        fiber_resume_with( name, salloc, results);
+    }
+    if ( selected( scenarios, "continuation") ) {
+        continuation_ping_pong( name, salloc, results);
+    }
+    if ( selected( scenarios, "deep") ) {
+        fiber_deep( name, salloc, results);
+    }
+    if ( selected( scenarios, "round-robin") ) {
+        for ( std::size_t n : fibers) {
+            fiber_round_robin( name, salloc, n, results);
+        }
+    }
+    if ( selected( scenarios, "cold") ) {
+        for ( std::size_t n : fibers) {
+            fiber_cold( name, salloc, n, results);
+        }
+    }
+    if ( selected( scenarios, "prefetch") ) {
+        for ( std::size_t n : fibers) {
+            fiber_prefetch( name, salloc, n, results);
+        }
+    }
+    if ( selected( scenarios, "create") ) {
+        fiber_create( name, salloc, results);
+    }
+    if ( selected( scenarios, "unwind") ) {
+        fiber_unwind( name, salloc, results);
+    }
+}
+
+std::vector< std::pair< std::string, std::string > > properties() {
+    std::vector< std::pair< std::string, std::string > > p;
+    p.emplace_back( "compiler", BOOST_COMPILER);
+    p.emplace_back( "platform", BOOST_PLATFORM);
+#if defined(BOOST_USE_UCONTEXT)
+    p.emplace_back( "implementation", "ucontext");
+#elif defined(BOOST_USE_WINFIB)
+    p.emplace_back( "implementation", "winfib");
+#else
+    p.emplace_back( "implementation", "fcontext");
+#endif
+#if defined(BOOST_USE_RET_SWITCH)
+    p.emplace_back( "switch-return", "ret");
+#endif
+#if defined(BOOST_CONTEXT_COMPACT_RECORD)
+    p.emplace_back( "record-layout", "compact");
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS)
+    p.emplace_back( "fiber-stats", "on");
+#endif
+    p.emplace_back( "stack-coloring", std::to_string( ctx::detail::record_color_span) );
+    p.emplace_back( "stack_size", std::to_string( stack_size) );
+    p.emplace_back( "samples", std::to_string( samples) );
+    p.emplace_back( "batch", std::to_string( batch) );
+    p.emplace_back( "touch", std::to_string( touch) );
+    p.emplace_back( "depth", std::to_string( depth) );
+    return p;
+}
+
+int main( int argc, char * argv[]) {
+    try {
+        std::string format{ "text" };
+        bool with_counters = false;
+        std::vector< std::string > raw;
+        boost::program_options::options_description desc("allowed options");
+        desc.add_options()
+            ("help", "help message")
+            ("samples,s", boost::program_options::value< std::size_t >( & samples), "samples per benchmark")
+            ("batch,b", boost::program_options::value< std::size_t >( & batch), "operations per sample")
+            ("stack-size", boost::program_options::value< std::size_t >( & stack_size), "stack size in bytes")
+            ("fibers,n", boost::program_options::value< std::vector< std::size_t > >( & fibers)->multitoken(),
+             "number of fibers in round-robin")
+            ("depth,d", boost::program_options::value< std::size_t >( & depth),
+             "frames of the call chain in deep")
+            ("touch,t", boost::program_options::value< std::size_t >( & touch),
+             "bytes of its stack touched by a fiber per resume in round-robin")
+            ("scenario", boost::program_options::value< std::vector< std::string > >( & scenarios)->multitoken(),
+             "fcontext, fiber, resume_with, continuation, deep, round-robin, cold, prefetch, create, unwind (default: all)")
+            ("allocator", boost::program_options::value< std::vector< std::string > >( & allocators)->multitoken(),
+             "fixedsize_stack, protected_fixedsize_stack, pooled_fixedsize_stack, segmented_stack (default: all)")
+            ("counters,c", boost::program_options::bool_switch( & with_counters),
+             "read hardware counters (cycles, instructions, branch- and L1 misses) per operation")
+            ("raw", boost::program_options::value< std::vector< std::string > >( & raw)->multitoken(),
+             "additional model specific counters as name=rUUEE, e.g. ret-misses=r08c5")
+            ("format,f", boost::program_options::value< std::string >( & format), "output format: text or json");
+
+        boost::program_options::variables_map vm;
+        boost::program_options::store(
+                boost::program_options::parse_command_line(
+                    argc,
+                    argv,
+                    desc),
+                vm);
+        boost::program_options::notify( vm);
+
+        if ( vm.count("help") ) {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+        if ( 0 == samples || 0 == batch) {
+            throw std::invalid_argument("samples and batch must not be zero");
+        }
+        if ( max_touch < touch) {
+            throw std::invalid_argument("touch exceeds " + std::to_string( max_touch) + " bytes");
+        }
+        if ( "text" != format && "json" != format) {
+            throw std::invalid_argument("unknown format: " + format);
+        }
+
+        // a context inherits the floating point control/status of its creator,
+        // jump_fcontext restores it on each switch; the arithmetic of the harness
+        // sets the sticky inexact flag of the main context - raise it in advance,
+        // otherwise the status of contexts created before differs and each
+        // switch has to change it (expensive)
+        volatile double inexact = 1.;
+        inexact = inexact / 3.;
+        std::vector< counter_spec > specs;
+        if ( with_counters || ! raw.empty() ) {
+            specs = default_counters();
+            for ( std::string const& str : raw) {
+                specs.push_back( parse_raw_counter( str) );
+            }
+        }
+        counters hardware{ specs };
+        for ( std::string const& error : hardware.errors() ) {
+            std::cerr << "counter not available: " << error << std::endl;
+        }
+        if ( ! hardware.empty() ) {
+            hw = & hardware;
+        }
+
+        std::vector< result > results;
+        run( "fixedsize_stack", ctx::fixedsize_stack{ stack_size }, results);
+        run( "protected_fixedsize_stack", ctx::protected_fixedsize_stack{ stack_size }, results);
+        run( "pooled_fixedsize_stack", ctx::pooled_fixedsize_stack{ stack_size }, results);
+#if defined(BOOST_USE_SEGMENTED_STACKS)
+        run( "segmented_stack", ctx::segmented_stack{ stack_size }, results);
+#endif
+
+        if ( "json" == format) {
+            report_json( std::cout, properties(), results);
+        } else {
+            report_text( std::cout, results);
+        }
+
+        return EXIT_SUCCESS;
+    } catch ( std::exception const& e) {
+        std::cerr << "exception: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "unhandled exception" << std::endl;
+    }
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,409 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// interposition of blocking socket calls (library boost_context_interpose)
+//
+// called by a fiber with registered scheduler on a thread with a reactor, a
+// call that would block parks the fiber at the reactor instead of blocking
+// the thread; as with the C library, a write to a stream socket in blocking
+// mode returns after all bytes were sent, as does a receive with
+// MSG_WAITALL after `len` bytes were received; other callers, file descriptors other than sockets and sockets
+// in non-blocking mode get the behaviour of the C library
+//
+// the overrides are exported explicitly, the library might be built with
+// hidden visibility; a preloaded library shares the thread local state
+// (scheduler, reactor) of the executable only if the executable exports it
+// (-rdynamic) and the inline functions keep default visibility
+
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE
+#endif
+
+extern "C" {
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+}
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/config.hpp>
+
+#include <boost/context/reactor.hpp>
+#include <boost/context/this_fiber.hpp>
+
+namespace {
+
+template< typename Fn >
+Fn next( char const* name) noexcept {
+    return reinterpret_cast< Fn >( ::dlsym( RTLD_NEXT, name) );
+}
+
+// definitions of the C library
+struct clib {
+    decltype( & ::read)         read{ next< decltype( & ::read) >( "read") };
+    decltype( & ::write)        write{ next< decltype( & ::write) >( "write") };
+    decltype( & ::readv)        readv{ next< decltype( & ::readv) >( "readv") };
+    decltype( & ::writev)       writev{ next< decltype( & ::writev) >( "writev") };
+    decltype( & ::recv)         recv{ next< decltype( & ::recv) >( "recv") };
+    decltype( & ::recvfrom)     recvfrom{ next< decltype( & ::recvfrom) >( "recvfrom") };
+    decltype( & ::recvmsg)      recvmsg{ next< decltype( & ::recvmsg) >( "recvmsg") };
+    decltype( & ::send)         send{ next< decltype( & ::send) >( "send") };
+    decltype( & ::sendto)       sendto{ next< decltype( & ::sendto) >( "sendto") };
+    decltype( & ::sendmsg)      sendmsg{ next< decltype( & ::sendmsg) >( "sendmsg") };
+    decltype( & ::accept)       accept{ next< decltype( & ::accept) >( "accept") };
+    decltype( & ::accept4)      accept4{ next< decltype( & ::accept4) >( "accept4") };
+    decltype( & ::connect)      connect{ next< decltype( & ::connect) >( "connect") };
+    decltype( & ::poll)         poll{ next< decltype( & ::poll) >( "poll") };
+    decltype( & ::close)        close{ next< decltype( & ::close) >( "close") };
+    decltype( & ::fcntl)        fcntl{ next< decltype( & ::fcntl) >( "fcntl") };
+};
+
+clib const& c() noexcept {
+    static const clib l{};
+    return l;
+}
+
+// reactor of the running thread if called by a fiber
+boost::context::reactor * interposing() noexcept {
+    boost::context::reactor * r = boost::context::reactor::current();
+    return nullptr != r && boost::context::this_fiber::has_scheduler() ? r : nullptr;
+}
+
+bool nonblocking( int fd) noexcept {
+    const int flags = c().fcntl( fd, F_GETFL);
+    return -1 != flags && 0 != ( flags & O_NONBLOCK);
+}
+
+// `try_io` does not block (MSG_DONTWAIT) but fails with ENOTSOCK for other
+// file descriptors than sockets, `io` is used instead
+template< typename TryIO, typename IO >
+ssize_t transfer( boost::context::reactor * r, int fd, std::uint32_t events, TryIO && try_io, IO && io) {
+    for (;;) {
+        const ssize_t result = try_io();
+        if ( -1 != result) {
+            return result;
+        }
+        if ( ENOTSOCK == errno) {
+            return io();
+        }
+        if ( ( EAGAIN != errno && EWOULDBLOCK != errno) || nonblocking( fd) ) {
+            return -1;
+        }
+        r->wait( fd, events);
+    }
+}
+
+// a stream socket transfers partially; a receive of a SOCK_SEQPACKET socket
+// ends at the boundary of the record
+bool continues( int fd, std::uint32_t events) noexcept {
+    int type = 0;
+    ::socklen_t len = sizeof( type);
+    if ( -1 == ::getsockopt( fd, SOL_SOCKET, SO_TYPE, & type, & len) ) {
+        return false;
+    }
+    return SOCK_STREAM == type || ( EPOLLOUT == events && SOCK_SEQPACKET == type);
+}
+
+// as transfer(), but all `len` bytes are transferred by a stream socket in
+// blocking mode; `try_io( done)` transfers the remainder after `done` bytes;
+// an error or the end of the stream after some progress returns the count of
+// bytes transferred so far
+template< typename TryIO, typename IO >
+ssize_t transfer_all( boost::context::reactor * r, int fd, std::uint32_t events, std::size_t len, TryIO && try_io, IO && io) {
+    ssize_t result = transfer( r, fd, events, [&try_io](){ return try_io( 0); }, io);
+    if ( 0 >= result || len <= static_cast< std::size_t >( result) ||
+         nonblocking( fd) || ! continues( fd, events) ) {
+        return result;
+    }
+    std::size_t done = static_cast< std::size_t >( result);
+    while ( done < len) {
+        result = transfer( r, fd, events, [&try_io,done](){ return try_io( done); }, io);
+        if ( 0 >= result) {
+            break;
+        }
+        done += static_cast< std::size_t >( result);
+    }
+    return static_cast< ssize_t >( done);
+}
+
+std::size_t length( ::iovec const* iov, std::size_t iovcnt) noexcept {
+    std::size_t len = 0;
+    for ( std::size_t i = 0; i < iovcnt; ++i) {
+        len += iov[i].iov_len;
+    }
+    return len;
+}
+
+// `msg` without the first `done` bytes of its vector, copied into `iov`;
+// the ancillary data was transferred with the first part
+::msghdr advance( ::msghdr msg, std::size_t done, std::vector< ::iovec > & iov) {
+    iov.assign( msg.msg_iov, msg.msg_iov + msg.msg_iovlen);
+    std::size_t i = 0;
+    for ( ; i < iov.size() && iov[i].iov_len <= done; ++i) {
+        done -= iov[i].iov_len;
+    }
+    if ( i < iov.size() ) {
+        iov[i].iov_base = static_cast< char * >( iov[i].iov_base) + done;
+        iov[i].iov_len -= done;
+    }
+    msg.msg_iov = iov.data() + i;
+    msg.msg_iovlen = iov.size() - i;
+    msg.msg_control = nullptr;
+    msg.msg_controllen = 0;
+    return msg;
+}
+
+// waits until `pfd->fd` is ready, `timeout` as poll()
+int ready( boost::context::reactor * r, ::pollfd * pfd, int timeout) {
+    const int result = c().poll( pfd, 1, 0);
+    if ( 0 != result || 0 == timeout) {
+        return result;
+    }
+    if ( 0 == r->wait( pfd->fd, static_cast< std::uint32_t >( pfd->events), timeout) ) {
+        // timeout expired
+        return 0;
+    }
+    return c().poll( pfd, 1, 0);
+}
+
+}
+
+extern "C" {
+
+BOOST_SYMBOL_EXPORT ssize_t read( int fd, void * buf, size_t count) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r) {
+        return c().read( fd, buf, count);
+    }
+    return transfer( r, fd, EPOLLIN,
+            [=](){ return c().recv( fd, buf, count, MSG_DONTWAIT); },
+            [=](){ return c().read( fd, buf, count); });
+}
+
+BOOST_SYMBOL_EXPORT ssize_t write( int fd, void const* buf, size_t count) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r) {
+        return c().write( fd, buf, count);
+    }
+    return transfer_all( r, fd, EPOLLOUT, count,
+            [=]( std::size_t done){
+                return c().send( fd, static_cast< char const* >( buf) + done, count - done, MSG_DONTWAIT);
+            },
+            [=](){ return c().write( fd, buf, count); });
+}
+
+BOOST_SYMBOL_EXPORT ssize_t readv( int fd, ::iovec const* iov, int iovcnt) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r) {
+        return c().readv( fd, iov, iovcnt);
+    }
+    return transfer( r, fd, EPOLLIN,
+            [=](){
+                ::msghdr msg{};
+                msg.msg_iov = const_cast< ::iovec * >( iov);
+                msg.msg_iovlen = iovcnt;
+                return c().recvmsg( fd, & msg, MSG_DONTWAIT);
+            },
+            [=](){ return c().readv( fd, iov, iovcnt); });
+}
+
+BOOST_SYMBOL_EXPORT ssize_t writev( int fd, ::iovec const* iov, int iovcnt) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r) {
+        return c().writev( fd, iov, iovcnt);
+    }
+    ::msghdr msg{};
+    msg.msg_iov = const_cast< ::iovec * >( iov);
+    msg.msg_iovlen = iovcnt;
+    std::vector< ::iovec > rest;
+    return transfer_all( r, fd, EPOLLOUT, length( iov, iovcnt),
+            [fd,&msg,&rest]( std::size_t done){
+                ::msghdr m = 0 == done ? msg : advance( msg, done, rest);
+                return c().sendmsg( fd, & m, MSG_DONTWAIT);
+            },
+            [=](){ return c().writev( fd, iov, iovcnt); });
+}
+
+BOOST_SYMBOL_EXPORT ssize_t recv( int fd, void * buf, size_t len, int flags) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r || 0 != ( flags & MSG_DONTWAIT) ) {
+        return c().recv( fd, buf, len, flags);
+    }
+    if ( 0 != ( flags & MSG_WAITALL) ) {
+        return transfer_all( r, fd, EPOLLIN, len,
+                [=]( std::size_t done){
+                    return c().recv( fd, static_cast< char * >( buf) + done, len - done, flags | MSG_DONTWAIT);
+                },
+                [=](){ return c().recv( fd, buf, len, flags); });
+    }
+    return transfer( r, fd, EPOLLIN,
+            [=](){ return c().recv( fd, buf, len, flags | MSG_DONTWAIT); },
+            [=](){ return c().recv( fd, buf, len, flags); });
+}
+
+BOOST_SYMBOL_EXPORT ssize_t recvfrom( int fd, void * buf, size_t len, int flags, ::sockaddr * addr, ::socklen_t * addrlen) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r || 0 != ( flags & MSG_DONTWAIT) ) {
+        return c().recvfrom( fd, buf, len, flags, addr, addrlen);
+    }
+    if ( 0 != ( flags & MSG_WAITALL) ) {
+        return transfer_all( r, fd, EPOLLIN, len,
+                [=]( std::size_t done){
+                    return c().recvfrom( fd, static_cast< char * >( buf) + done, len - done, flags | MSG_DONTWAIT, addr, addrlen);
+                },
+                [=](){ return c().recvfrom( fd, buf, len, flags, addr, addrlen); });
+    }
+    return transfer( r, fd, EPOLLIN,
+            [=](){ return c().recvfrom( fd, buf, len, flags | MSG_DONTWAIT, addr, addrlen); },
+            [=](){ return c().recvfrom( fd, buf, len, flags, addr, addrlen); });
+}
+
+BOOST_SYMBOL_EXPORT ssize_t recvmsg( int fd, ::msghdr * msg, int flags) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r || 0 != ( flags & MSG_DONTWAIT) ) {
+        return c().recvmsg( fd, msg, flags);
+    }
+    if ( 0 != ( flags & MSG_WAITALL) ) {
+        std::vector< ::iovec > rest;
+        return transfer_all( r, fd, EPOLLIN, length( msg->msg_iov, msg->msg_iovlen),
+                [fd,msg,flags,&rest]( std::size_t done){
+                    if ( 0 == done) {
+                        return c().recvmsg( fd, msg, flags | MSG_DONTWAIT);
+                    }
+                    ::msghdr m = advance( * msg, done, rest);
+                    const ssize_t result = c().recvmsg( fd, & m, flags | MSG_DONTWAIT);
+                    if ( -1 != result) {
+                        msg->msg_flags |= m.msg_flags;
+                    }
+                    return result;
+                },
+                [=](){ return c().recvmsg( fd, msg, flags); });
+    }
+    return transfer( r, fd, EPOLLIN,
+            [=](){ return c().recvmsg( fd, msg, flags | MSG_DONTWAIT); },
+            [=](){ return c().recvmsg( fd, msg, flags); });
+}
+
+BOOST_SYMBOL_EXPORT ssize_t send( int fd, void const* buf, size_t len, int flags) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r || 0 != ( flags & MSG_DONTWAIT) ) {
+        return c().send( fd, buf, len, flags);
+    }
+    return transfer_all( r, fd, EPOLLOUT, len,
+            [=]( std::size_t done){
+                return c().send( fd, static_cast< char const* >( buf) + done, len - done, flags | MSG_DONTWAIT);
+            },
+            [=](){ return c().send( fd, buf, len, flags); });
+}
+
+BOOST_SYMBOL_EXPORT ssize_t sendto( int fd, void const* buf, size_t len, int flags, ::sockaddr const* addr, ::socklen_t addrlen) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r || 0 != ( flags & MSG_DONTWAIT) ) {
+        return c().sendto( fd, buf, len, flags, addr, addrlen);
+    }
+    return transfer_all( r, fd, EPOLLOUT, len,
+            [=]( std::size_t done){
+                return c().sendto( fd, static_cast< char const* >( buf) + done, len - done, flags | MSG_DONTWAIT, addr, addrlen);
+            },
+            [=](){ return c().sendto( fd, buf, len, flags, addr, addrlen); });
+}
+
+BOOST_SYMBOL_EXPORT ssize_t sendmsg( int fd, ::msghdr const* msg, int flags) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r || 0 != ( flags & MSG_DONTWAIT) ) {
+        return c().sendmsg( fd, msg, flags);
+    }
+    std::vector< ::iovec > rest;
+    return transfer_all( r, fd, EPOLLOUT, length( msg->msg_iov, msg->msg_iovlen),
+            [fd,msg,flags,&rest]( std::size_t done){
+                ::msghdr m = 0 == done ? * msg : advance( * msg, done, rest);
+                return c().sendmsg( fd, & m, flags | MSG_DONTWAIT);
+            },
+            [=](){ return c().sendmsg( fd, msg, flags); });
+}
+
+// accepts after the listening socket became readable; might block if another
+// thread accepted the connection meanwhile
+BOOST_SYMBOL_EXPORT int accept4( int fd, ::sockaddr * addr, ::socklen_t * addrlen, int flags) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr != r && ! nonblocking( fd) ) {
+        ::pollfd pfd{ fd, POLLIN, 0 };
+        ready( r, & pfd, -1);
+    }
+    return c().accept4( fd, addr, addrlen, flags);
+}
+
+BOOST_SYMBOL_EXPORT int accept( int fd, ::sockaddr * addr, ::socklen_t * addrlen) {
+    return accept4( fd, addr, addrlen, 0);
+}
+
+BOOST_SYMBOL_EXPORT int connect( int fd, ::sockaddr const* addr, ::socklen_t addrlen) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r) {
+        return c().connect( fd, addr, addrlen);
+    }
+    const int flags = c().fcntl( fd, F_GETFL);
+    if ( -1 == flags || 0 != ( flags & O_NONBLOCK) ) {
+        return c().connect( fd, addr, addrlen);
+    }
+    // the connection is established in the background
+    c().fcntl( fd, F_SETFL, flags | O_NONBLOCK);
+    const int result = c().connect( fd, addr, addrlen);
+    const int error = errno;
+    c().fcntl( fd, F_SETFL, flags);
+    if ( -1 != result || EINPROGRESS != error) {
+        errno = error;
+        return result;
+    }
+    r->wait( fd, EPOLLOUT);
+    int so_error = 0;
+    ::socklen_t len = sizeof( so_error);
+    if ( -1 == ::getsockopt( fd, SOL_SOCKET, SO_ERROR, & so_error, & len) ) {
+        return -1;
+    }
+    if ( 0 != so_error) {
+        errno = so_error;
+        return -1;
+    }
+    return 0;
+}
+
+// parks if a single file descriptor is polled
+BOOST_SYMBOL_EXPORT int poll( ::pollfd * fds, ::nfds_t nfds, int timeout) {
+    boost::context::reactor * r = interposing();
+    if ( nullptr == r || 1 != nfds) {
+        return c().poll( fds, nfds, timeout);
+    }
+    return ready( r, fds, timeout);
+}
+
+// wakes the fibers waiting for `fd`; deregistered before it is closed, a
+// duplicated descriptor would remain registered at epoll otherwise
+BOOST_SYMBOL_EXPORT int close( int fd) {
+    boost::context::reactor * r = boost::context::reactor::current();
+    if ( nullptr == r) {
+        return c().close( fd);
+    }
+    int result = 0;
+    int error = 0;
+    r->cancel( fd, [fd,&result,&error](){
+                result = c().close( fd);
+                error = errno;
+            });
+    // the resumed fibers might have changed errno
+    errno = error;
+    return result;
+}
+
+}
@@ -27,6 +27,7 @@
 #include <boost/variant.hpp>
 
 #include <boost/context/continuation.hpp>
+#include <boost/context/size_class_stack.hpp>
 #include <boost/context/detail/config.hpp>
 
 #ifdef BOOST_WINDOWS
@@ -242,6 +243,22 @@ void test_prealloc() {
     BOOST_CHECK( ! c);
 }
 
+void test_stack_size() {
+    value1 = 0;
+    ctx::size_class_stack alloc;
+    ctx::continuation c = ctx::callcc(
+        std::allocator_arg, alloc, 128 * 1024,
+        []( ctx::continuation && c) {
+            // more than the smallest size class
+            char buffer[100 * 1024];
+            std::snprintf( buffer, sizeof( buffer), "%d", 42);
+            value1 = std::atoi( buffer);
+            return std::move( c);
+        });
+    BOOST_CHECK_EQUAL( 42, value1);
+    BOOST_CHECK( ! c);
+}
+
 void test_ontop() {
     {
         int i = 3;
@@ -496,6 +513,7 @@ int main()
     test_fp();
     test_stacked();
     test_prealloc();
+    test_stack_size();
     test_ontop();
     test_ontop_exception();
     test_termination1();
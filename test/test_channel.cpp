@@ -0,0 +1,281 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/channel.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+// runs `fn` in a fiber with the calling context as its scheduler,
+// until it terminates or parks
+template< typename Fn >
+ctx::fiber spawn( Fn fn) {
+    ctx::fiber f{ [fn]( ctx::fiber && sched) mutable {
+                ctx::this_fiber::set_scheduler( std::move( sched) );
+                fn();
+                return ctx::this_fiber::release_scheduler();
+            }};
+    // yields are resumed immediately
+    do {
+        f = std::move( f).resume();
+    } while ( f);
+    return f;
+}
+
+void test_try() {
+    {
+        ctx::bounded_channel< int > chan{ 2 };
+        int i = 0;
+        BOOST_CHECK( ctx::channel_op_status::empty == chan.try_pop( i) );
+        BOOST_CHECK( ctx::channel_op_status::success == chan.try_push( 1) );
+        BOOST_CHECK( ctx::channel_op_status::success == chan.try_push( 2) );
+        BOOST_CHECK( ctx::channel_op_status::full == chan.try_push( 3) );
+        BOOST_CHECK( ctx::channel_op_status::success == chan.try_pop( i) );
+        BOOST_CHECK_EQUAL( 1, i);
+        chan.close();
+        BOOST_CHECK( chan.is_closed() );
+        BOOST_CHECK( ctx::channel_op_status::closed == chan.try_push( 4) );
+        // values pushed before close() are delivered
+        BOOST_CHECK( ctx::channel_op_status::success == chan.pop( i) );
+        BOOST_CHECK_EQUAL( 2, i);
+        BOOST_CHECK( ctx::channel_op_status::closed == chan.pop( i) );
+    }
+    {
+        bool thrown = false;
+        try {
+            ctx::bounded_channel< int > chan{ 3 };
+        } catch ( std::invalid_argument const&) {
+            thrown = true;
+        }
+        BOOST_CHECK( thrown);
+    }
+    {
+        // queued values are destroyed with the channel
+        std::shared_ptr< int > p = std::make_shared< int >( 7);
+        {
+            ctx::unbounded_channel< std::shared_ptr< int > > chan;
+            chan.push( p);
+            chan.push( p);
+            BOOST_CHECK_EQUAL( 3, p.use_count() );
+        }
+        BOOST_CHECK_EQUAL( 1, p.use_count() );
+    }
+}
+
+template< typename Channel >
+void test_handoff( Channel & chan) {
+    std::vector< std::string > received;
+    int phase = 0;
+    // consumer parks
+    ctx::fiber f = spawn( [&chan,&received,&phase](){
+                std::string s;
+                while ( ctx::channel_op_status::success == chan.pop( s) ) {
+                    // runs inside of push()
+                    BOOST_CHECK_EQUAL( 1, phase);
+                    received.push_back( s);
+                }
+                phase = 2;
+            });
+    BOOST_CHECK( ! f);
+    BOOST_CHECK( received.empty() );
+    phase = 1;
+    chan.push( std::string("abc") );
+    BOOST_CHECK_EQUAL( 1u, received.size() );
+    chan.push( std::string("def") );
+    BOOST_CHECK_EQUAL( 2u, received.size() );
+    chan.close();
+    BOOST_CHECK_EQUAL( 2, phase);
+    BOOST_CHECK( "abc" == received[0]);
+    BOOST_CHECK( "def" == received[1]);
+}
+
+void test_handoff() {
+    ctx::bounded_channel< std::string > chan1{ 4 };
+    test_handoff( chan1);
+    ctx::unbounded_channel< std::string > chan2;
+    test_handoff( chan2);
+}
+
+// copy constructor and copy assignment throw on demand
+struct fragile {
+    static bool     fail;
+
+    int             value{ 0 };
+
+    fragile() = default;
+
+    explicit fragile( int value_) noexcept :
+        value{ value_ } {
+    }
+
+    fragile( fragile const& other) :
+        value{ other.value } {
+        if ( fail) {
+            throw std::runtime_error{ "copy failed" };
+        }
+    }
+
+    fragile( fragile &&) noexcept = default;
+
+    fragile & operator=( fragile const& other) {
+        if ( fail) {
+            throw std::runtime_error{ "copy failed" };
+        }
+        value = other.value;
+        return * this;
+    }
+
+    fragile & operator=( fragile &&) noexcept = default;
+};
+
+bool fragile::fail = false;
+
+template< typename Channel >
+void test_throwing_copy( Channel & chan) {
+    const fragile v1{ 1 }, v2{ 2 };
+    fragile::fail = true;
+    bool thrown = false;
+    try {
+        chan.push( v1);
+    } catch ( std::runtime_error const&) {
+        thrown = true;
+    }
+    fragile::fail = false;
+    BOOST_CHECK( thrown);
+    // neither a cell nor the consumer is lost
+    BOOST_CHECK( ctx::channel_op_status::success == chan.push( v2) );
+    fragile r;
+    BOOST_CHECK( ctx::channel_op_status::success == chan.try_pop( r) );
+    BOOST_CHECK_EQUAL( 2, r.value);
+    BOOST_CHECK( ctx::channel_op_status::empty == chan.try_pop( r) );
+    // parked consumer, direct handoff
+    int received = 0;
+    ctx::fiber f = spawn( [&chan,&received](){
+                fragile x;
+                while ( ctx::channel_op_status::success == chan.pop( x) ) {
+                    received = x.value;
+                }
+            });
+    fragile::fail = true;
+    thrown = false;
+    try {
+        chan.push( v1);
+    } catch ( std::runtime_error const&) {
+        thrown = true;
+    }
+    fragile::fail = false;
+    BOOST_CHECK( thrown);
+    BOOST_CHECK_EQUAL( 0, received);
+    chan.push( v2);
+    BOOST_CHECK_EQUAL( 2, received);
+    chan.close();
+}
+
+void test_throwing_copy() {
+    ctx::bounded_channel< fragile > chan1{ 2 };
+    test_throwing_copy( chan1);
+    ctx::unbounded_channel< fragile > chan2;
+    test_throwing_copy( chan2);
+}
+
+void test_full() {
+    // producer fiber yields while the channel is full
+    ctx::bounded_channel< int > chan{ 2 };
+    std::vector< int > received;
+    ctx::fiber producer{ [&chan]( ctx::fiber && sched) {
+                ctx::this_fiber::set_scheduler( std::move( sched) );
+                for ( int i = 0; i < 10; ++i) {
+                    chan.push( i);
+                }
+                chan.close();
+                return ctx::this_fiber::release_scheduler();
+            }};
+    ctx::channel_op_status st = ctx::channel_op_status::empty;
+    while ( ctx::channel_op_status::closed != st) {
+        if ( producer) {
+            // runs until the channel is full
+            producer = std::move( producer).resume();
+        }
+        int i = 0;
+        while ( ctx::channel_op_status::success == ( st = chan.try_pop( i) ) ) {
+            received.push_back( i);
+        }
+    }
+    BOOST_CHECK( ! producer);
+    BOOST_CHECK_EQUAL( 10u, received.size() );
+    for ( int j = 0; j < 10; ++j) {
+        BOOST_CHECK_EQUAL( j, received[j]);
+    }
+}
+
+template< typename Channel >
+void test_threads( Channel & chan) {
+    constexpr int producers = 4;
+    constexpr int values = 2000;
+    std::atomic< bool > done{ false };
+    std::vector< int > last( producers, -1);
+    bool ordered = true;
+    int count = 0;
+    // the consumer migrates to the thread of the producer that resumes it
+    ctx::fiber f = spawn( [&](){
+                int v = 0;
+                while ( ctx::channel_op_status::success == chan.pop( v) ) {
+                    const int p = v / values;
+                    ordered = ordered && last[p] < v;
+                    last[p] = v;
+                    ++count;
+                }
+                done = true;
+            });
+    BOOST_CHECK( ! f);
+    std::vector< std::thread > threads;
+    for ( int p = 0; p < producers; ++p) {
+        threads.emplace_back( [&chan,p](){
+                for ( int i = 0; i < values; ++i) {
+                    chan.push( p * values + i);
+                }
+            });
+    }
+    for ( std::thread & t : threads) {
+        t.join();
+    }
+    chan.close();
+    BOOST_CHECK( done);
+    BOOST_CHECK( ordered);
+    BOOST_CHECK_EQUAL( producers * values, count);
+}
+
+void test_threads() {
+    ctx::bounded_channel< int > chan1{ 16 };
+    test_threads( chan1);
+    ctx::unbounded_channel< int > chan2;
+    test_threads( chan2);
+}
+
+int main()
+{
+    test_try();
+    test_handoff();
+    test_throwing_copy();
+    test_full();
+    test_threads();
+
+    return boost::report_errors();
+}
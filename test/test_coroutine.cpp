@@ -0,0 +1,229 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <coroutine>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/coroutine.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+// completed by set(), resumes the awaiting coroutine
+template< typename T >
+class event {
+private:
+    std::coroutine_handle<>     h_{};
+    T                           value_{};
+    bool                        ready_{ false };
+    bool                        fail_{ false };
+
+public:
+    bool await_ready() const noexcept {
+        return ready_;
+    }
+
+    void await_suspend( std::coroutine_handle<> h) noexcept {
+        h_ = h;
+    }
+
+    T await_resume() {
+        if ( fail_) {
+            throw std::runtime_error{ "event failed" };
+        }
+        return value_;
+    }
+
+    void set( T value) {
+        value_ = std::move( value);
+        ready_ = true;
+        if ( h_) {
+            std::exchange( h_, nullptr).resume();
+        }
+    }
+
+    void fail() {
+        fail_ = true;
+        ready_ = true;
+        if ( h_) {
+            std::exchange( h_, nullptr).resume();
+        }
+    }
+};
+
+// eagerly started coroutine
+struct task {
+    struct promise_type {
+        task get_return_object() noexcept {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept {
+            return {};
+        }
+
+        void return_void() const noexcept {
+        }
+
+        void unhandled_exception() const noexcept {
+            std::terminate();
+        }
+    };
+};
+
+ctx::fiber make_fiber( ctx::pooled_fixedsize_stack & salloc, int & value, event< int > & ev) {
+    return ctx::fiber{ std::allocator_arg, salloc,
+                       [&value,&ev]( ctx::fiber && sched) {
+                            ctx::this_fiber::set_scheduler( std::move( sched) );
+                            value = ctx::this_fiber::await( ev);
+                            return ctx::this_fiber::release_scheduler();
+                       }};
+}
+
+void test_await_ready() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    int value = 0;
+    event< int > ev;
+    ev.set( 3);
+    ctx::fiber f = make_fiber( salloc, value, ev);
+    f = std::move( f).resume();
+    BOOST_CHECK( ! f);
+    BOOST_CHECK_EQUAL( 3, value);
+    // void awaitable
+    ctx::this_fiber::await( std::suspend_never{});
+}
+
+void test_await_parked() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    int value = 0;
+    event< int > ev;
+    ctx::fiber f = make_fiber( salloc, value, ev);
+    // parked, owned by the bridging coroutine
+    f = std::move( f).resume();
+    BOOST_CHECK( ! f);
+    BOOST_CHECK_EQUAL( 0, value);
+    // resumes the fiber until it terminates
+    ev.set( 7);
+    BOOST_CHECK_EQUAL( 7, value);
+}
+
+void test_await_exception() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    std::string what;
+    event< int > ev;
+    ctx::fiber f{ std::allocator_arg, salloc,
+                  [&what,&ev]( ctx::fiber && sched) {
+                        ctx::this_fiber::set_scheduler( std::move( sched) );
+                        try {
+                            ctx::this_fiber::await( ev);
+                        } catch ( std::runtime_error const& e) {
+                            what = e.what();
+                        }
+                        return ctx::this_fiber::release_scheduler();
+                  }};
+    f = std::move( f).resume();
+    BOOST_CHECK( ! f);
+    ev.fail();
+    BOOST_CHECK_EQUAL( std::string{ "event failed" }, what);
+}
+
+// resumes the awaiting coroutine on a new thread
+struct resume_on_thread {
+    std::thread &   t;
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    void await_suspend( std::coroutine_handle<> h) {
+        t = std::thread{ [h](){ h.resume(); } };
+    }
+
+    std::string await_resume() const {
+        return "abc";
+    }
+};
+
+void test_await_thread() {
+    // main context without scheduler spins
+    std::thread t;
+    BOOST_CHECK_EQUAL( std::string{ "abc" }, ctx::this_fiber::await( resume_on_thread{ t }) );
+    t.join();
+}
+
+task co_value( int & value, ctx::pooled_fixedsize_stack salloc) {
+    value = co_await ctx::co_fiber( std::allocator_arg, salloc, [](){
+                ctx::this_fiber::yield();
+                return 5;
+            });
+}
+
+void test_co_fiber() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    int value = 0;
+    // the fiber terminates before the coroutine is suspended
+    co_value( value, salloc);
+    BOOST_CHECK_EQUAL( 5, value);
+}
+
+task co_parked( int & value, event< int > & ev, ctx::pooled_fixedsize_stack salloc) {
+    value = co_await ctx::co_fiber( std::allocator_arg, salloc, [&ev](){
+                return ctx::this_fiber::await( ev) + 1;
+            });
+}
+
+void test_co_fiber_parked() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    int value = 0;
+    event< int > ev;
+    // fiber parked, coroutine suspended
+    co_parked( value, ev, salloc);
+    BOOST_CHECK_EQUAL( 0, value);
+    // resumes the fiber which resumes the coroutine
+    ev.set( 1);
+    BOOST_CHECK_EQUAL( 2, value);
+}
+
+task co_exception( std::string & what) {
+    try {
+        co_await ctx::co_fiber( [](){
+                    throw std::runtime_error{ "fiber failed" };
+                });
+    } catch ( std::runtime_error const& e) {
+        what = e.what();
+    }
+}
+
+void test_co_fiber_exception() {
+    std::string what;
+    co_exception( what);
+    BOOST_CHECK_EQUAL( std::string{ "fiber failed" }, what);
+}
+
+int main() {
+    test_await_ready();
+    test_await_parked();
+    test_await_exception();
+    test_await_thread();
+    test_co_fiber();
+    test_co_fiber_parked();
+    test_co_fiber_exception();
+
+    return boost::report_errors();
+}
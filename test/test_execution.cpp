@@ -0,0 +1,182 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/execution.hpp>
+#include <boost/context/nursery.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+namespace ex = boost::context::execution;
+
+// completes inline with `value`
+struct just_sender {
+    using sender_concept = ex::sender_t;
+    using completion_signatures = ex::completion_signatures<
+        ex::set_value_t( int, std::string)
+    >;
+
+    int             i;
+    std::string     s;
+
+    template< typename Receiver >
+    struct operation {
+        Receiver        r;
+        int             i;
+        std::string     s;
+
+        void start() noexcept {
+            std::move( r).set_value( i, std::move( s) );
+        }
+    };
+
+    template< typename Receiver >
+    operation< Receiver > connect( Receiver r) && {
+        return { std::move( r), i, std::move( s) };
+    }
+};
+
+// completes inline with set_error()
+template< typename E >
+struct error_sender {
+    using sender_concept = ex::sender_t;
+    using completion_signatures = ex::completion_signatures<
+        ex::set_value_t(),
+        ex::set_error_t( E)
+    >;
+
+    E   e;
+
+    template< typename Receiver >
+    struct operation {
+        Receiver    r;
+        E           e;
+
+        void start() noexcept {
+            std::move( r).set_error( std::move( e) );
+        }
+    };
+
+    template< typename Receiver >
+    operation< Receiver > connect( Receiver r) && {
+        return { std::move( r), std::move( e) };
+    }
+};
+
+// records the completion
+struct recording_receiver {
+    using receiver_concept = ex::receiver_t;
+
+    std::vector< std::string >  *   trace;
+
+    void set_value() noexcept {
+        trace->push_back( ctx::this_fiber::has_scheduler() ? "value on fiber" : "value");
+    }
+
+    void set_error( std::exception_ptr) noexcept {
+        trace->push_back( "error");
+    }
+
+    void set_stopped() noexcept {
+        trace->push_back( "stopped");
+    }
+};
+
+void test_sync_wait_value() {
+    auto v = ctx::this_fiber::sync_wait( just_sender{ 3, "abc" });
+    BOOST_CHECK( v.has_value() );
+    BOOST_CHECK_EQUAL( 3, std::get< 0 >( * v) );
+    BOOST_CHECK_EQUAL( std::string{ "abc" }, std::get< 1 >( * v) );
+}
+
+void test_sync_wait_error() {
+    bool thrown = false;
+    try {
+        ctx::this_fiber::sync_wait(
+            error_sender< std::exception_ptr >{ std::make_exception_ptr( std::runtime_error{ "failed" }) });
+    } catch ( std::runtime_error const&) {
+        thrown = true;
+    }
+    BOOST_CHECK( thrown);
+    thrown = false;
+    try {
+        ctx::this_fiber::sync_wait(
+            error_sender< std::error_code >{ std::make_error_code( std::errc::timed_out) });
+    } catch ( std::system_error const& e) {
+        thrown = std::errc::timed_out == e.code();
+    }
+    BOOST_CHECK( thrown);
+}
+
+void test_schedule() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    std::vector< std::string > trace;
+    ctx::nursery n{ salloc };
+    ctx::fiber_scheduler sched{ n };
+    BOOST_CHECK( sched == ctx::fiber_scheduler{ n });
+    auto op = sched.schedule().connect( recording_receiver{ & trace });
+    op.start();
+    BOOST_CHECK( trace.empty() );
+    // completes on a child fiber
+    n.join();
+    BOOST_CHECK_EQUAL( std::size_t{ 1 }, trace.size() );
+    BOOST_CHECK_EQUAL( std::string{ "value on fiber" }, trace[0]);
+}
+
+void test_schedule_stopped() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    std::vector< std::string > trace;
+    ctx::nursery n{ salloc };
+    ctx::fiber_scheduler sched{ n };
+    auto op = sched.schedule().connect( recording_receiver{ & trace });
+    op.start();
+    n.cancel();
+    n.join();
+    BOOST_CHECK_EQUAL( std::size_t{ 1 }, trace.size() );
+    BOOST_CHECK_EQUAL( std::string{ "stopped" }, trace[0]);
+}
+
+void test_sync_wait_parked() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    std::vector< int > trace;
+    ctx::nursery n{ salloc };
+    ctx::fiber_scheduler sched{ n };
+    n.spawn( [&trace,sched](){
+                trace.push_back( 1);
+                // parks, resumed by the child the sender completes on
+                auto v = ctx::this_fiber::sync_wait( sched.schedule() );
+                BOOST_CHECK( v.has_value() );
+                trace.push_back( 3);
+            });
+    n.spawn( [&trace](){
+                trace.push_back( 2);
+            });
+    n.join();
+    std::vector< int > expected{ 1, 2, 3 };
+    BOOST_TEST_ALL_EQ( expected.begin(), expected.end(), trace.begin(), trace.end() );
+}
+
+int main() {
+    test_sync_wait_value();
+    test_sync_wait_error();
+    test_schedule();
+    test_schedule_stopped();
+    test_sync_wait_parked();
+
+    return boost::report_errors();
+}
@@ -26,13 +26,23 @@
 #include <boost/utility.hpp>
 #include <boost/variant.hpp>
 
+#include <boost/context/any_stack_allocator.hpp>
 #include <boost/context/fiber.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
+#include <boost/context/size_class_stack.hpp>
+#include <boost/context/this_fiber.hpp>
 #include <boost/context/detail/config.hpp>
+#include <boost/context/detail/prefetch.hpp>
 
 #ifdef BOOST_WINDOWS
 #include <windows.h>
 #endif
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 #define BOOST_CHECK(x) BOOST_TEST(x)
 #define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
 
@@ -248,6 +258,388 @@ void test_prealloc() {
     BOOST_CHECK( ! f);
 }
 
+// stack allocator without allocate( size)
+struct plain_stack {
+    ctx::fixedsize_stack    salloc;
+
+    ctx::stack_context allocate() {
+        return salloc.allocate();
+    }
+
+    void deallocate( ctx::stack_context & sctx) noexcept {
+        salloc.deallocate( sctx);
+    }
+};
+
+void test_stack_size() {
+    {
+        ctx::fixedsize_stack alloc( 64 * 1024);
+        ctx::stack_context sctx = alloc.allocate( 32 * 1024);
+        BOOST_CHECK_EQUAL( std::size_t( 32 * 1024), sctx.size);
+        alloc.deallocate( sctx);
+    }
+    {
+        ctx::pooled_fixedsize_stack alloc( 64 * 1024);
+        ctx::stack_context sctx1 = alloc.allocate( 16 * 1024);
+        BOOST_CHECK_EQUAL( std::size_t( 64 * 1024), sctx1.size);
+        ctx::stack_context sctx2 = alloc.allocate( 128 * 1024);
+        BOOST_CHECK_EQUAL( std::size_t( 128 * 1024), sctx2.size);
+        alloc.deallocate( sctx2);
+        alloc.deallocate( sctx1);
+    }
+    {
+        ctx::size_class_stack alloc;
+        ctx::stack_context sctx1 = alloc.allocate();
+        BOOST_CHECK_EQUAL( std::size_t( 16 * 1024), sctx1.size);
+        ctx::stack_context sctx2 = alloc.allocate( 20 * 1024);
+        BOOST_CHECK_EQUAL( std::size_t( 64 * 1024), sctx2.size);
+        ctx::stack_context sctx3 = alloc.allocate( 200 * 1024);
+        BOOST_CHECK_EQUAL( std::size_t( 256 * 1024), sctx3.size);
+        ctx::stack_context sctx4 = alloc.allocate( 512 * 1024);
+        BOOST_CHECK_EQUAL( std::size_t( 512 * 1024), sctx4.size);
+        alloc.deallocate( sctx4);
+        alloc.deallocate( sctx3);
+        alloc.deallocate( sctx2);
+        alloc.deallocate( sctx1);
+    }
+    {
+        value1 = 0;
+        ctx::size_class_stack alloc;
+        ctx::fiber f{ std::allocator_arg, alloc, 128 * 1024,
+            []( ctx::fiber && f) {
+                // more than the smallest size class
+                char buffer[100 * 1024];
+                std::snprintf( buffer, sizeof( buffer), "%d", 42);
+                value1 = std::atoi( buffer);
+                return std::move( f);
+            }};
+        f = std::move( f).resume();
+        BOOST_CHECK_EQUAL( 42, value1);
+        BOOST_CHECK( ! f);
+    }
+    {
+        value1 = 0;
+        ctx::fiber f{ std::allocator_arg, plain_stack{}, 16 * 1024,
+            []( ctx::fiber && f) {
+                value1 = 7;
+                return std::move( f);
+            }};
+        f = std::move( f).resume();
+        BOOST_CHECK_EQUAL( 7, value1);
+        BOOST_CHECK( ! f);
+    }
+}
+
+void test_prefault() {
+#if defined(__linux__)
+    {
+        // page aligned stack
+        ctx::protected_fixedsize_stack alloc( 64 * 1024, 16 * 1024);
+        ctx::stack_context sctx = alloc.allocate();
+        const std::size_t pages = 16 * 1024 / ctx::stack_traits::page_size();
+        std::vector< unsigned char > resident( pages, 0);
+        BOOST_CHECK_EQUAL( 0, ::mincore( static_cast< char * >( sctx.sp) - 16 * 1024, 16 * 1024, resident.data() ) );
+        for ( unsigned char c : resident) {
+            BOOST_CHECK( 0 != ( c & 1) );
+        }
+        alloc.deallocate( sctx);
+    }
+#endif
+    {
+        value1 = 0;
+        ctx::fiber f{ std::allocator_arg, ctx::fixedsize_stack( 64 * 1024, 16 * 1024),
+            []( ctx::fiber && f) {
+                value1 = 3;
+                return std::move( f);
+            }};
+        f = std::move( f).resume();
+        BOOST_CHECK_EQUAL( 3, value1);
+    }
+    {
+        value1 = 0;
+        // prefault larger than the stack
+        ctx::pooled_fixedsize_stack alloc( 16 * 1024, 4, 0, 64 * 1024);
+        std::thread{ [alloc]() mutable {
+            alloc.reserve( 8);
+        }}.join();
+        std::vector< ctx::fiber > fibers;
+        for ( int i = 0; i < 8; ++i) {
+            fibers.emplace_back( std::allocator_arg, alloc,
+                []( ctx::fiber && f) {
+                    ++value1;
+                    return std::move( f);
+                });
+        }
+        for ( ctx::fiber & f : fibers) {
+            f = std::move( f).resume();
+            BOOST_CHECK( ! f);
+        }
+        BOOST_CHECK_EQUAL( 8, value1);
+    }
+}
+
+// counts the stacks in use
+class counting_resource : public ctx::stack_resource {
+private:
+    ctx::fixedsize_stack    salloc_{};
+
+protected:
+    ctx::stack_context do_allocate() override {
+        ++value1;
+        return salloc_.allocate();
+    }
+
+    ctx::stack_context do_allocate( std::size_t size) override {
+        ++value1;
+        return salloc_.allocate( size);
+    }
+
+    void do_deallocate( ctx::stack_context & sctx) noexcept override {
+        --value1;
+        salloc_.deallocate( sctx);
+    }
+};
+
+void test_any_stack_allocator() {
+    BOOST_CHECK_EQUAL( sizeof( void *), sizeof( ctx::any_stack_allocator) );
+    {
+        value1 = 0;
+        counting_resource resource;
+        ctx::any_stack_allocator alloc{ & resource };
+        ctx::fiber f1{ std::allocator_arg, alloc,
+            []( ctx::fiber && f) {
+                return std::move( f);
+            }};
+        ctx::fiber f2{ std::allocator_arg, alloc, 32 * 1024,
+            []( ctx::fiber && f) {
+                return std::move( f);
+            }};
+        BOOST_CHECK_EQUAL( 2, value1);
+        f1 = std::move( f1).resume();
+        BOOST_CHECK( ! f1);
+        // ucontext_t/WinFiber release the stack with the handle
+        f1 = ctx::fiber{};
+        BOOST_CHECK_EQUAL( 1, value1);
+        f2 = ctx::fiber{};
+        BOOST_CHECK_EQUAL( 0, value1);
+    }
+    {
+        value1 = 0;
+        ctx::stack_resource_adaptor< ctx::pooled_fixedsize_stack > resource{ 64 * 1024 };
+        ctx::stack_context sctx = resource.allocate( 128 * 1024);
+        BOOST_CHECK_EQUAL( std::size_t( 128 * 1024), sctx.size);
+        resource.deallocate( sctx);
+        ctx::fiber f{ std::allocator_arg, ctx::any_stack_allocator{ & resource },
+            []( ctx::fiber && f) {
+                value1 = 3;
+                return std::move( f);
+            }};
+        f = std::move( f).resume();
+        BOOST_CHECK_EQUAL( 3, value1);
+        BOOST_CHECK( ! f);
+    }
+    {
+        value1 = 0;
+        ctx::fiber f{ std::allocator_arg, ctx::any_stack_allocator{},
+            []( ctx::fiber && f) {
+                value1 = 5;
+                return std::move( f);
+            }};
+        f = std::move( f).resume();
+        BOOST_CHECK_EQUAL( 5, value1);
+        BOOST_CHECK( ! f);
+    }
+}
+
+void test_migrate() {
+    value1 = 0;
+    ctx::fiber f{
+        []( ctx::fiber && f) {
+            value1 = 1;
+            f = std::move( f).resume();
+            // now running on the second thread
+            value1 = 2;
+            f = std::move( f).resume();
+            value1 = 3;
+            return std::move( f);
+        }};
+    f = std::move( f).resume();
+    BOOST_CHECK_EQUAL( 1, value1);
+    // pinned to this thread while suspended
+    f.pin();
+    f.unpin();
+    std::thread t([&f](){
+            ctx::fiber g = std::move( f).migrate();
+            g.pin();
+            g = std::move( g).resume();
+            BOOST_CHECK_EQUAL( 2, value1);
+            g.unpin();
+            f = std::move( g).migrate();
+        });
+    t.join();
+    BOOST_CHECK( f);
+    f = std::move( f).resume();
+    BOOST_CHECK_EQUAL( 3, value1);
+    BOOST_CHECK( ! f);
+}
+
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY) && ! defined(BOOST_USE_UCONTEXT) && ! defined(BOOST_USE_WINFIB)
+void test_affinity() {
+    value1 = 0;
+    ctx::fiber f{
+        []( ctx::fiber && f) {
+            for ( int i = 0; i < 3; ++i) {
+                ++value1;
+                f = std::move( f).resume();
+            }
+            return std::move( f);
+        }};
+    f = std::move( f).resume();
+    f.pin();
+    // the binding survives the round trip
+    f = std::move( f).resume();
+    BOOST_CHECK_EQUAL( 2, value1);
+    f.unpin();
+    std::thread t([&f](){
+            // resumed on another thread: migrate() hands over an unbound fiber
+            ctx::fiber g = std::move( f).migrate();
+            g = std::move( g).resume();
+            BOOST_CHECK_EQUAL( 3, value1);
+            g.pin();
+            g.unpin();
+            f = std::move( g).migrate();
+        });
+    t.join();
+    f = std::move( f).resume();
+    BOOST_CHECK( ! f);
+}
+#endif
+
+#if defined(BOOST_CONTEXT_FIBER_STATS) && ! defined(BOOST_USE_UCONTEXT) && ! defined(BOOST_USE_WINFIB)
+void test_stats() {
+    const ctx::fiber_stats main0 = ctx::this_fiber::stats();
+    ctx::fiber f{
+        []( ctx::fiber && f) {
+            for ( int i = 0; i < 3; ++i) {
+                f = std::move( f).resume();
+            }
+            // resumed by the main context four times
+            BOOST_CHECK_EQUAL( std::uint64_t{ 4 }, ctx::this_fiber::stats().switches);
+            volatile std::uint64_t x = 0;
+            for ( int i = 0; i < 100000; ++i) {
+                x = x + i;
+            }
+            BOOST_CHECK( 0 < ctx::this_fiber::stats().running);
+            return std::move( f);
+        }};
+    BOOST_CHECK_EQUAL( std::uint64_t{ 0 }, f.stats().switches);
+    for ( std::uint64_t i = 1; i < 4; ++i) {
+        f = std::move( f).resume();
+        BOOST_CHECK_EQUAL( i, f.stats().switches);
+        BOOST_CHECK( 0 < f.stats().suspended);
+    }
+    f = std::move( f).resume();
+    BOOST_CHECK( ! f);
+    // the main context was resumed four times
+    const ctx::fiber_stats main1 = ctx::this_fiber::stats();
+    BOOST_CHECK_EQUAL( main0.switches + 4, main1.switches);
+    BOOST_CHECK( main0.running < main1.running);
+    BOOST_CHECK( main0.suspended < main1.suspended);
+    // unwinding a suspended fiber
+    ctx::fiber g{
+        []( ctx::fiber && g) {
+            g = std::move( g).resume();
+            return std::move( g);
+        }};
+    g = std::move( g).resume();
+    g = ctx::fiber{};
+    BOOST_CHECK_EQUAL( main1.switches + 2, ctx::this_fiber::stats().switches);
+}
+#endif
+
+void deep_yield( int n) {
+    if ( 0 < n) {
+        deep_yield( n - 1);
+    } else {
+        ++value1;
+        ctx::this_fiber::yield();
+        ++value1;
+    }
+}
+
+void test_this_fiber() {
+    value1 = 0;
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+    void const* main_id = ctx::this_fiber::get_id();
+    void const* ids[2] = { nullptr, nullptr };
+#endif
+    std::vector< ctx::fiber > v;
+    for ( int i = 0; i < 2; ++i) {
+        v.emplace_back( [&,i]( ctx::fiber && f) {
+                ctx::this_fiber::set_scheduler( std::move( f) );
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+                ids[i] = ctx::this_fiber::get_id();
+#endif
+                deep_yield( 5);
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+                BOOST_CHECK( ids[i] == ctx::this_fiber::get_id() );
+#endif
+                return ctx::this_fiber::release_scheduler();
+            });
+    }
+    // round-robin until all fibers have terminated
+    while ( ! v.empty() ) {
+        ctx::fiber f = std::move( v.front() );
+        v.erase( v.begin() );
+        f = std::move( f).resume();
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+        BOOST_CHECK( main_id == ctx::this_fiber::get_id() );
+#endif
+        if ( f) {
+            v.push_back( std::move( f) );
+        }
+    }
+    BOOST_CHECK_EQUAL( 4, value1);
+#if defined(BOOST_CONTEXT_HAS_THIS_FIBER_ID)
+    BOOST_CHECK( nullptr != ids[0]);
+    BOOST_CHECK( ids[0] != ids[1]);
+    BOOST_CHECK( main_id != ids[0]);
+#endif
+}
+
+void test_prefetch() {
+    {
+        char buffer[1024];
+        ctx::detail::prefetch_range( buffer + 3, 0);
+        ctx::detail::prefetch_range( buffer + 3, sizeof( buffer) - 3);
+    }
+    {
+        // round-robin, prefetching the next fiber
+        value1 = 0;
+        std::vector< ctx::fiber > v;
+        for ( int i = 0; i < 3; ++i) {
+            v.emplace_back( []( ctx::fiber && f) {
+                    ++value1;
+                    f = std::move( f).resume();
+                    ++value1;
+                    return std::move( f);
+                });
+        }
+        for ( int n = 0; n < 2; ++n) {
+            for ( std::size_t i = 0; i < v.size(); ++i) {
+                if ( i + 1 < v.size() ) {
+                    v[i + 1].prefetch();
+                }
+                v[i] = std::move( v[i]).resume();
+            }
+        }
+        BOOST_CHECK_EQUAL( 6, value1);
+        for ( ctx::fiber & f : v) {
+            BOOST_CHECK( ! f);
+        }
+    }
+}
+
 void test_ontop() {
     {
         int i = 3;
@@ -518,6 +910,18 @@ int main()
     test_fp();
     test_stacked();
     test_prealloc();
+    test_stack_size();
+    test_prefault();
+    test_any_stack_allocator();
+    test_migrate();
+#if defined(BOOST_CONTEXT_CHECK_AFFINITY) && ! defined(BOOST_USE_UCONTEXT) && ! defined(BOOST_USE_WINFIB)
+    test_affinity();
+#endif
+#if defined(BOOST_CONTEXT_FIBER_STATS) && ! defined(BOOST_USE_UCONTEXT) && ! defined(BOOST_USE_WINFIB)
+    test_stats();
+#endif
+    test_this_fiber();
+    test_prefetch();
     test_ontop();
     test_ontop_exception();
     test_termination1();
@@ -0,0 +1,122 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/fork_join.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+int fib( int n) {
+    if ( 2 > n) {
+        return n;
+    }
+    int a = 0;
+    ctx::fork_join fj;
+    fj.spawn( [&a,n](){ a = fib( n - 1); });
+    const int b = fib( n - 2);
+    fj.sync();
+    return a + b;
+}
+
+long sum( std::vector< long > const& v, std::size_t first, std::size_t last) {
+    if ( 1024 >= last - first) {
+        return std::accumulate( v.begin() + first, v.begin() + last, 0L);
+    }
+    const std::size_t middle = first + ( last - first) / 2;
+    long l = 0, r = 0;
+    ctx::fork_join fj;
+    fj.spawn( [&](){ l = sum( v, first, middle); });
+    fj.spawn( [&](){ r = sum( v, middle, last); });
+    fj.sync();
+    return l + r;
+}
+
+void test_fib() {
+    ctx::fork_join_pool pool{ 4, ctx::pooled_fixedsize_stack{ 64 * 1024 } };
+    BOOST_CHECK_EQUAL( std::size_t{ 4 }, pool.size() );
+    int result = 0;
+    pool.run( [&result](){ result = fib( 20); });
+    BOOST_CHECK_EQUAL( 6765, result);
+    // reusable
+    pool.run( [&result](){ result = fib( 10); });
+    BOOST_CHECK_EQUAL( 55, result);
+}
+
+void test_sum() {
+    ctx::fork_join_pool pool{ 3 };
+    std::vector< long > v( 1 << 20);
+    std::iota( v.begin(), v.end(), 0L);
+    long result = 0;
+    pool.run( [&](){ result = sum( v, 0, v.size() ); });
+    BOOST_CHECK_EQUAL( std::accumulate( v.begin(), v.end(), 0L), result);
+}
+
+void test_steal() {
+    ctx::fork_join_pool pool{ 2 };
+    std::atomic< bool > continued{ false };
+    std::thread::id child, parent;
+    pool.run( [&](){
+                ctx::fork_join fj;
+                fj.spawn( [&](){
+                            child = std::this_thread::get_id();
+                            // returns only if the continuation of the parent
+                            // runs meanwhile - on the other worker
+                            while ( ! continued.load() ) {
+                                std::this_thread::yield();
+                            }
+                        });
+                continued = true;
+                parent = std::this_thread::get_id();
+                fj.sync();
+            });
+    BOOST_CHECK( continued.load() );
+    BOOST_CHECK( child != parent);
+}
+
+void test_exception() {
+    ctx::fork_join_pool pool{ 2 };
+    bool caught = false;
+    int completed = 0;
+    pool.run( [&](){
+                ctx::fork_join fj;
+                fj.spawn( [](){ throw std::runtime_error{ "failed" }; });
+                fj.spawn( [&completed](){ ++completed; });
+                try {
+                    fj.sync();
+                } catch ( std::runtime_error const&) {
+                    caught = true;
+                }
+            });
+    BOOST_CHECK( caught);
+    BOOST_CHECK_EQUAL( 1, completed);
+    bool thrown = false;
+    try {
+        pool.run( [](){ throw std::logic_error{ "root" }; });
+    } catch ( std::logic_error const&) {
+        thrown = true;
+    }
+    BOOST_CHECK( thrown);
+}
+
+int main() {
+    test_fib();
+    test_sum();
+    test_steal();
+    test_exception();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,96 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// not linked with src/posix/interpose.cpp: the shared library
+// boost_context_interpose (path passed as argument) is loaded by LD_PRELOAD,
+// the test executes itself again with the environment variable set;
+// linked with -rdynamic, the library shares the thread local state of
+// the executable
+
+extern "C" {
+#include <poll.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+}
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/nursery.hpp>
+#include <boost/context/reactor.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+void test_poll() {
+    ctx::reactor r;
+    int fds[2];
+    ::socketpair( AF_UNIX, SOCK_STREAM, 0, fds);
+    int result = -1;
+    ctx::nursery n;
+    n.spawn( [&](){
+                ::pollfd pfd{ fds[0], POLLIN, 0 };
+                // parks; blocks the thread until the timeout expired and
+                // returns 0 if not interposed
+                result = ::poll( & pfd, 1, 1000);
+            });
+    n.spawn( [&](){
+                ::send( fds[1], "x", 1, 0);
+            });
+    n.join( [&r](){ return r.run_once(); });
+    BOOST_CHECK_EQUAL( 1, result);
+    ::close( fds[0]);
+    ::close( fds[1]);
+}
+
+void test_read() {
+    ctx::reactor r;
+    int fds[2];
+    ::socketpair( AF_UNIX, SOCK_STREAM, 0, fds);
+    std::vector< std::string > trace;
+    ctx::nursery n;
+    n.spawn( [&](){
+                char buf[8] = { 0 };
+                trace.push_back( "read");
+                const ssize_t size = ::read( fds[0], buf, sizeof( buf) );
+                trace.push_back( std::string( buf, 0 < size ? size : 0) );
+            });
+    n.spawn( [&](){
+                trace.push_back( "write");
+                ::write( fds[1], "abc", 3);
+            });
+    n.join( [&r](){ return r.run_once(); });
+    std::vector< std::string > expected{ "read", "write", "abc" };
+    BOOST_TEST_ALL_EQ( expected.begin(), expected.end(), trace.begin(), trace.end() );
+    ::close( fds[0]);
+    ::close( fds[1]);
+}
+
+int main( int argc, char * argv[]) {
+    if ( 2 > argc) {
+        BOOST_ERROR( "path of boost_context_interpose expected");
+        return boost::report_errors();
+    }
+    if ( nullptr == ::getenv( "BOOST_CONTEXT_TEST_PRELOADED") ) {
+        ::setenv( "BOOST_CONTEXT_TEST_PRELOADED", "1", 1);
+        ::setenv( "LD_PRELOAD", argv[1], 1);
+        ::execv( "/proc/self/exe", argv);
+        BOOST_ERROR( "execv() failed");
+        return boost::report_errors();
+    }
+    test_poll();
+    // would block if not interposed, test_poll() failed already
+    if ( 0 == boost::detail::test_errors() ) {
+        test_read();
+    }
+
+    return boost::report_errors();
+}
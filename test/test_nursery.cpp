@@ -0,0 +1,151 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/fiber.hpp>
+#include <boost/context/nursery.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/semaphore.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+void test_join() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    std::vector< int > trace;
+    {
+        ctx::nursery n{ salloc };
+        for ( int i = 0; i < 3; ++i) {
+            n.spawn( [&trace,i](){
+                        for ( int j = 0; j < 2; ++j) {
+                            trace.push_back( i);
+                            ctx::this_fiber::yield();
+                        }
+                    });
+        }
+        // spawned by a child
+        n.spawn( [&n,&trace](){
+                    n.spawn( [&trace](){ trace.push_back( 4); });
+                });
+        n.join();
+        BOOST_CHECK( ! n.cancelled() );
+    }
+    // round-robin
+    int expected[] = { 0, 1, 2, 0, 1, 2, 4 };
+    BOOST_CHECK_EQUAL( 7u, trace.size() );
+    for ( std::size_t k = 0; k < trace.size(); ++k) {
+        BOOST_CHECK_EQUAL( expected[k], trace[k]);
+    }
+    // the pool is shared with another nursery
+    ctx::nursery n{ salloc };
+    int count = 0;
+    n.spawn( [&count](){ ++count; });
+    n.join();
+    BOOST_CHECK_EQUAL( 1, count);
+}
+
+void test_exception() {
+    ctx::nursery n;
+    bool cancelled = false, started = false;
+    n.spawn( [](){
+                ctx::this_fiber::yield();
+                throw std::runtime_error("abc");
+            });
+    n.spawn( [&n,&cancelled](){
+                while ( ! n.cancelled() ) {
+                    ctx::this_fiber::yield();
+                }
+                cancelled = true;
+            });
+    n.spawn( [&n](){
+                n.spawn( [](){ throw std::logic_error("def"); });
+            });
+    std::string what;
+    try {
+        n.join();
+    } catch ( std::runtime_error const& e) {
+        what = e.what();
+    }
+    // only the first exception is propagated
+    BOOST_CHECK_EQUAL( std::string("abc"), what);
+    BOOST_CHECK( cancelled);
+    // children spawned after cancellation are skipped
+    n.spawn( [&started](){ started = true; });
+    n.join();
+    BOOST_CHECK( ! started);
+}
+
+void test_parked() {
+    ctx::semaphore sem;
+    std::atomic< int > done{ 0 };
+    {
+        // joined by a thread, the children are resumed by another thread
+        ctx::nursery n;
+        for ( int i = 0; i < 4; ++i) {
+            n.spawn( [&sem,&done](){
+                        sem.acquire();
+                        ++done;
+                    });
+        }
+        std::thread t{ [&sem](){ sem.release( 4); } };
+        n.join();
+        t.join();
+        BOOST_CHECK_EQUAL( 4, done);
+    }
+    {
+        // joined by a fiber which parks until the last child terminates
+        bool joined = false;
+        ctx::fiber f{ [&sem,&done,&joined]( ctx::fiber && sched) {
+                    ctx::this_fiber::set_scheduler( std::move( sched) );
+                    ctx::nursery n;
+                    n.spawn( [&sem,&done](){
+                                sem.acquire();
+                                ++done;
+                            });
+                    n.join();
+                    joined = true;
+                    return ctx::this_fiber::release_scheduler();
+                }};
+        f = std::move( f).resume();
+        BOOST_CHECK( ! f);
+        BOOST_CHECK( ! joined);
+        // resumes the child, the child resumes the joining fiber
+        sem.release();
+        BOOST_CHECK( joined);
+        BOOST_CHECK_EQUAL( 5, done);
+    }
+}
+
+void test_destructor() {
+    int count = 0;
+    {
+        ctx::nursery n;
+        n.spawn( [&count](){ ++count; });
+        n.spawn( [](){ throw std::runtime_error("dropped"); });
+    }
+    // cancelled before start
+    BOOST_CHECK_EQUAL( 0, count);
+}
+
+int main()
+{
+    test_join();
+    test_exception();
+    test_parked();
+    test_destructor();
+
+    return boost::report_errors();
+}
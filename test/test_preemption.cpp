@@ -0,0 +1,104 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/nursery.hpp>
+#include <boost/context/preemption.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+// CPU bound, no explicit yield
+void spin_for( std::chrono::milliseconds duration) {
+    const auto deadline = std::chrono::steady_clock::now() + duration;
+    while ( std::chrono::steady_clock::now() < deadline) {
+    }
+}
+
+void test_preempt() {
+    ctx::preemption_timer timer{ std::chrono::milliseconds{ 1 } };
+    std::atomic< bool > flag{ false };
+    bool preempted = false;
+    ctx::nursery n;
+    n.spawn( [&](){
+                ctx::this_fiber::preemptible p;
+                // terminates only if the sibling runs meanwhile
+                while ( ! flag.load( std::memory_order_relaxed) ) {
+                }
+                preempted = true;
+            });
+    n.spawn( [&](){
+                flag.store( true, std::memory_order_relaxed);
+            });
+    n.join();
+    BOOST_CHECK( preempted);
+}
+
+void test_round_robin() {
+    ctx::preemption_timer timer{ std::chrono::milliseconds{ 1 } };
+    std::vector< int > trace;
+    ctx::nursery n;
+    for ( int i = 0; i < 2; ++i) {
+        n.spawn( [&trace,i](){
+                    for ( int j = 0; j < 3; ++j) {
+                        {
+                            ctx::this_fiber::preemptible p;
+                            spin_for( std::chrono::milliseconds{ 5 });
+                        }
+                        // allocates, outside of the region
+                        trace.push_back( i);
+                    }
+                });
+    }
+    n.join();
+    BOOST_CHECK_EQUAL( std::size_t{ 6 }, trace.size() );
+    // the children interleave
+    bool interleaved = false;
+    for ( std::size_t i = 1; i < trace.size() - 1; ++i) {
+        interleaved = interleaved || trace[i] != trace[i - 1];
+    }
+    BOOST_CHECK( interleaved);
+}
+
+void test_not_preemptible() {
+    ctx::preemption_timer timer{ std::chrono::milliseconds{ 1 } };
+    bool flag = false;
+    bool overtaken = true;
+    ctx::nursery n;
+    n.spawn( [&](){
+                // outside of a preemptible region
+                spin_for( std::chrono::milliseconds{ 20 });
+                overtaken = flag;
+                {
+                    ctx::this_fiber::preemptible p;
+                    // nested regions
+                    ctx::this_fiber::preemptible q;
+                }
+                spin_for( std::chrono::milliseconds{ 20 });
+                overtaken = overtaken || flag;
+            });
+    n.spawn( [&](){
+                flag = true;
+            });
+    n.join();
+    BOOST_CHECK( ! overtaken);
+    BOOST_CHECK( flag);
+}
+
+int main() {
+    test_preempt();
+    test_round_robin();
+    test_not_preemptible();
+
+    return boost::report_errors();
+}
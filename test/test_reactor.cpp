@@ -0,0 +1,281 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// linked with src/posix/interpose.cpp
+
+extern "C" {
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+}
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/nursery.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/reactor.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+struct socket_pair {
+    int     fds[2];
+
+    socket_pair() {
+        ::socketpair( AF_UNIX, SOCK_STREAM, 0, fds);
+    }
+
+    ~socket_pair() {
+        ::close( fds[0]);
+        ::close( fds[1]);
+    }
+};
+
+void test_wait() {
+    ctx::reactor r;
+    BOOST_CHECK( & r == ctx::reactor::current() );
+    socket_pair sp;
+    std::vector< std::string > trace;
+    ctx::nursery n;
+    n.spawn( [&](){
+                char c = 0;
+                BOOST_CHECK_EQUAL( std::uint32_t( EPOLLIN), r.wait( sp.fds[0], EPOLLIN) & EPOLLIN);
+                BOOST_CHECK_EQUAL( 1, ::recv( sp.fds[0], & c, 1, MSG_DONTWAIT) );
+                trace.push_back( std::string{ "received " } + c);
+            });
+    n.spawn( [&](){
+                trace.push_back( "send");
+                ::send( sp.fds[1], "x", 1, 0);
+            });
+    n.join( [&r](){ return r.run_once(); });
+    BOOST_CHECK_EQUAL( std::size_t{ 2 }, trace.size() );
+    BOOST_CHECK_EQUAL( std::string{ "send" }, trace[0]);
+    BOOST_CHECK_EQUAL( std::string{ "received x" }, trace[1]);
+    BOOST_CHECK_EQUAL( std::size_t{ 0 }, r.waiting() );
+}
+
+void test_timeout() {
+    ctx::reactor r;
+    socket_pair sp;
+    int result = -1;
+    ctx::nursery n;
+    n.spawn( [&](){
+                ::pollfd pfd{ sp.fds[0], POLLIN, 0 };
+                // interposed
+                result = ::poll( & pfd, 1, 10);
+            });
+    n.join( [&r](){ return r.run_once(); });
+    BOOST_CHECK_EQUAL( 0, result);
+}
+
+void test_interpose_read() {
+    ctx::reactor r;
+    socket_pair sp;
+    std::vector< std::string > trace;
+    ctx::nursery n;
+    n.spawn( [&](){
+                char buf[8] = { 0 };
+                trace.push_back( "read");
+                // parks instead of blocking the thread
+                const ssize_t size = ::read( sp.fds[0], buf, sizeof( buf) );
+                trace.push_back( std::string( buf, 0 < size ? size : 0) );
+            });
+    n.spawn( [&](){
+                trace.push_back( "write");
+                BOOST_CHECK_EQUAL( 3, ::write( sp.fds[1], "abc", 3) );
+            });
+    n.join( [&r](){ return r.run_once(); });
+    std::vector< std::string > expected{ "read", "write", "abc" };
+    BOOST_TEST_ALL_EQ( expected.begin(), expected.end(), trace.begin(), trace.end() );
+}
+
+void test_write_all() {
+    ctx::reactor r;
+    socket_pair sp;
+    const std::size_t size = 4 * 1024 * 1024;
+    std::vector< char > data( size);
+    for ( std::size_t i = 0; i < size; ++i) {
+        data[i] = static_cast< char >( i % 251);
+    }
+    ssize_t written = 0;
+    std::vector< char > received;
+    ctx::nursery n;
+    n.spawn( [&](){
+                // more than the socket buffer, sent in several parts
+                written = ::write( sp.fds[1], data.data(), data.size() );
+                ::shutdown( sp.fds[1], SHUT_WR);
+            });
+    n.spawn( [&](){
+                // slow reader, small chunks
+                char buf[4096];
+                ssize_t len;
+                while ( 0 < ( len = ::read( sp.fds[0], buf, sizeof( buf) ) ) ) {
+                    received.insert( received.end(), buf, buf + len);
+                }
+            });
+    n.join( [&r](){ return r.run_once(); });
+    BOOST_CHECK_EQUAL( ssize_t( size), written);
+    BOOST_CHECK( data == received);
+}
+
+void test_recv_waitall() {
+    ctx::reactor r;
+    socket_pair sp;
+    char buf[10] = { 0 };
+    ssize_t result = 0;
+    ctx::nursery n;
+    n.spawn( [&](){
+                result = ::recv( sp.fds[0], buf, sizeof( buf), MSG_WAITALL);
+            });
+    n.spawn( [&](){
+                BOOST_CHECK_EQUAL( 5, ::send( sp.fds[1], "01234", 5, 0) );
+                // the receiver runs meanwhile
+                r.wait( sp.fds[1], EPOLLIN, 10);
+                BOOST_CHECK_EQUAL( 5, ::send( sp.fds[1], "56789", 5, 0) );
+            });
+    n.join( [&r](){ return r.run_once(); });
+    BOOST_CHECK_EQUAL( 10, result);
+    BOOST_CHECK_EQUAL( std::string{ "0123456789" }, std::string( buf, sizeof( buf) ) );
+}
+
+void test_interpose_close() {
+    ctx::reactor r;
+    int fds[2];
+    ::socketpair( AF_UNIX, SOCK_STREAM, 0, fds);
+    ssize_t result = 0;
+    int error = 0;
+    ctx::nursery n;
+    n.spawn( [&](){
+                char c;
+                result = ::read( fds[0], & c, 1);
+                error = errno;
+            });
+    n.spawn( [&](){
+                // wakes the reader
+                ::close( fds[0]);
+            });
+    n.join( [&r](){ return r.run_once(); });
+    ::close( fds[1]);
+    BOOST_CHECK_EQUAL( -1, result);
+    BOOST_CHECK_EQUAL( EBADF, error);
+}
+
+void test_close_duplicated() {
+    ctx::reactor r;
+    int fds[2];
+    ::socketpair( AF_UNIX, SOCK_STREAM, 0, fds);
+    // keeps the description alive after close()
+    const int dup = ::dup( fds[0]);
+    const int closed = fds[0];
+    std::uint32_t events = 1;
+    ctx::nursery n;
+    n.spawn( [&](){
+                r.wait( closed, EPOLLIN);
+                ::send( fds[1], "z", 1, 0);
+                // likely the same number as the closed descriptor
+                socket_pair sp;
+                // the description readable via `dup` must not be reported
+                events = r.wait( sp.fds[0], EPOLLIN, 50);
+            });
+    n.spawn( [&](){
+                ::close( closed);
+            });
+    n.join( [&r](){ return r.run_once(); });
+    BOOST_CHECK_EQUAL( std::uint32_t{ 0 }, events);
+    ::close( dup);
+    ::close( fds[1]);
+}
+
+void test_loopback() {
+    ctx::reactor r;
+    const int listener = ::socket( AF_INET, SOCK_STREAM, 0);
+    ::sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl( INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    BOOST_CHECK_EQUAL( 0, ::bind( listener, reinterpret_cast< ::sockaddr * >( & addr), sizeof( addr) ) );
+    ::socklen_t len = sizeof( addr);
+    ::getsockname( listener, reinterpret_cast< ::sockaddr * >( & addr), & len);
+    BOOST_CHECK_EQUAL( 0, ::listen( listener, 16) );
+    const int clients = 8;
+    int replies = 0;
+    ctx::nursery n;
+    // blocking echo server, one fiber per connection
+    n.spawn( [&](){
+                for ( int i = 0; i < clients; ++i) {
+                    const int conn = ::accept( listener, nullptr, nullptr);
+                    BOOST_CHECK( -1 != conn);
+                    n.spawn( [conn](){
+                                char buf[16];
+                                ssize_t size;
+                                while ( 0 < ( size = ::recv( conn, buf, sizeof( buf), 0) ) ) {
+                                    ::send( conn, buf, size, 0);
+                                }
+                                ::close( conn);
+                            });
+                }
+            });
+    // blocking clients
+    for ( int i = 0; i < clients; ++i) {
+        n.spawn( [&,i](){
+                    const int s = ::socket( AF_INET, SOCK_STREAM, 0);
+                    BOOST_CHECK_EQUAL( 0, ::connect( s, reinterpret_cast< ::sockaddr * >( & addr), sizeof( addr) ) );
+                    const std::string msg = "ping " + std::to_string( i);
+                    BOOST_CHECK_EQUAL( ssize_t( msg.size() ), ::write( s, msg.data(), msg.size() ) );
+                    char buf[16] = { 0 };
+                    std::size_t received = 0;
+                    while ( received < msg.size() ) {
+                        const ssize_t size = ::read( s, buf + received, sizeof( buf) - received);
+                        if ( 0 >= size) {
+                            break;
+                        }
+                        received += size;
+                    }
+                    if ( msg == std::string( buf, received) ) {
+                        ++replies;
+                    }
+                    ::close( s);
+                });
+    }
+    n.join( [&r](){ return r.run_once(); });
+    ::close( listener);
+    BOOST_CHECK_EQUAL( clients, replies);
+}
+
+void test_not_interposed() {
+    // main context: behaviour of the C library
+    ctx::reactor r;
+    socket_pair sp;
+    BOOST_CHECK_EQUAL( 1, ::write( sp.fds[1], "y", 1) );
+    char c = 0;
+    BOOST_CHECK_EQUAL( 1, ::read( sp.fds[0], & c, 1) );
+    BOOST_CHECK_EQUAL( 'y', c);
+    BOOST_CHECK( ! r.run_once( 0) );
+}
+
+int main() {
+    test_wait();
+    test_timeout();
+    test_interpose_read();
+    test_write_all();
+    test_recv_waitall();
+    test_interpose_close();
+    test_close_duplicated();
+    test_loopback();
+    test_not_interposed();
+
+    return boost::report_errors();
+}
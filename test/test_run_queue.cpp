@@ -0,0 +1,116 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/pooled_fixedsize_stack.hpp>
+#include <boost/context/run_queue.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+void test_round_robin() {
+    ctx::run_queue q;
+    std::vector< std::string > trace;
+    for ( int i = 0; i < 3; ++i) {
+        q.spawn( [&q,&trace,i](){
+                    for ( int j = 0; j < 2; ++j) {
+                        trace.push_back( std::to_string( i) + std::to_string( j) );
+                        q.yield();
+                    }
+                });
+    }
+    BOOST_CHECK_EQUAL( std::size_t{ 3 }, q.ready() );
+    q.run();
+    std::vector< std::string > expected{ "00", "10", "20", "01", "11", "21" };
+    BOOST_TEST_ALL_EQ( expected.begin(), expected.end(), trace.begin(), trace.end() );
+    BOOST_CHECK_EQUAL( std::size_t{ 0 }, q.ready() );
+}
+
+void test_spawn_nested() {
+    ctx::pooled_fixedsize_stack salloc{ 64 * 1024 };
+    ctx::run_queue q{ salloc };
+    std::vector< int > trace;
+    q.spawn( [&q,&trace](){
+                trace.push_back( 1);
+                q.spawn( [&trace](){
+                            trace.push_back( 3);
+                        });
+                // single ready fiber: continues after the child terminated
+                q.yield();
+                trace.push_back( 4);
+                // nothing ready: returns at once
+                q.yield();
+                trace.push_back( 5);
+            });
+    q.spawn( [&trace](){
+                trace.push_back( 2);
+            });
+    q.run();
+    std::vector< int > expected{ 1, 2, 3, 4, 5 };
+    BOOST_TEST_ALL_EQ( expected.begin(), expected.end(), trace.begin(), trace.end() );
+    // reusable
+    q.spawn( [&trace](){
+                trace.push_back( 6);
+            });
+    q.run();
+    BOOST_CHECK_EQUAL( 6, trace.back() );
+}
+
+void test_exception() {
+    ctx::run_queue q;
+    int completed = 0;
+    q.spawn( [&q](){
+                q.yield();
+                throw std::runtime_error{ "failed" };
+            });
+    for ( int i = 0; i < 2; ++i) {
+        q.spawn( [&q,&completed](){
+                    q.yield();
+                    q.yield();
+                    ++completed;
+                });
+    }
+    bool thrown = false;
+    try {
+        q.run();
+    } catch ( std::runtime_error const&) {
+        thrown = true;
+    }
+    BOOST_CHECK( thrown);
+    // the siblings completed
+    BOOST_CHECK_EQUAL( 2, completed);
+}
+
+void test_unwind() {
+    int unwound = 0;
+    struct guard {
+        int & i;
+        ~guard() { ++i; }
+    };
+    {
+        ctx::run_queue q;
+        q.spawn( [&unwound](){
+                    guard g{ unwound };
+                });
+        // not run, unwound with the queue
+    }
+    BOOST_CHECK_EQUAL( 0, unwound);
+}
+
+int main() {
+    test_round_robin();
+    test_spawn_nested();
+    test_exception();
+    test_unwind();
+
+    return boost::report_errors();
+}
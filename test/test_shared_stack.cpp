@@ -0,0 +1,138 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/fiber.hpp>
+#include <boost/context/shared_stack.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+// fills `n` frames with `value`, suspends at the bottom and verifies the
+// frames after being resumed
+BOOST_NOINLINE
+bool descend( ctx::fiber & caller, std::size_t n, char value) {
+    char buffer[128];
+    std::memset( buffer, value, sizeof( buffer) );
+    bool ok = true;
+    if ( 0 == n) {
+        caller = std::move( caller).resume();
+    } else {
+        ok = descend( caller, n - 1, value);
+    }
+    for ( char c : buffer) {
+        ok = ok && value == c;
+    }
+    return ok;
+}
+
+void test_interleaved() {
+    ctx::shared_stack stack{ 64 * 1024 };
+    std::vector< ctx::shared_fiber > v;
+    std::vector< int > results( 4, 0);
+    for ( int i = 0; i < 4; ++i) {
+        v.emplace_back( stack, [i,&results]( ctx::fiber && caller) {
+                    std::string s( 10, static_cast< char >( 'a' + i) );
+                    for ( int j = 0; j < 3; ++j) {
+                        // different depths per fiber
+                        if ( descend( caller, 4 * i, static_cast< char >( i + 1) )
+                             && std::string( 10, static_cast< char >( 'a' + i) ) == s) {
+                            ++results[i];
+                        }
+                    }
+                    return std::move( caller);
+                });
+    }
+    // the fibers are moved by the reallocation of `v`
+    v.reserve( 16);
+    bool running = true;
+    while ( running) {
+        running = false;
+        for ( ctx::shared_fiber & f : v) {
+            if ( f) {
+                f.resume();
+                running = true;
+            }
+        }
+    }
+    for ( int i = 0; i < 4; ++i) {
+        BOOST_CHECK_EQUAL( 3, results[i]);
+        BOOST_CHECK( ! v[i]);
+    }
+}
+
+void test_stack_usage() {
+    ctx::shared_stack stack{ 64 * 1024 };
+    ctx::shared_fiber f1{ stack, []( ctx::fiber && caller) {
+                descend( caller, 8, 1);
+                return std::move( caller);
+            }};
+    ctx::shared_fiber f2{ stack, []( ctx::fiber && caller) {
+                caller = std::move( caller).resume();
+                return std::move( caller);
+            }};
+    f1.resume();
+    const std::size_t usage = f1.stack_usage();
+    BOOST_CHECK( 8 * 128 < usage);
+    BOOST_CHECK( stack.size() > usage);
+    // f1 is evicted
+    f2.resume();
+    BOOST_CHECK_EQUAL( usage, f1.stack_usage() );
+    BOOST_CHECK_EQUAL( usage, f1.capacity() );
+    BOOST_CHECK( f2.stack_usage() < usage);
+    f1.resume();
+    BOOST_CHECK( ! f1);
+    f2.resume();
+    BOOST_CHECK( ! f2);
+}
+
+struct guard {
+    int & count;
+
+    ~guard() {
+        ++count;
+    }
+};
+
+void test_unwind() {
+    ctx::shared_stack stack{ 64 * 1024 };
+    int count = 0;
+    {
+        ctx::shared_fiber f1{ stack, [&count]( ctx::fiber && caller) {
+                    guard g{ count };
+                    caller = std::move( caller).resume();
+                    return std::move( caller);
+                }};
+        f1.resume();
+        ctx::shared_fiber f2{ stack, [&count]( ctx::fiber && caller) {
+                    guard g{ count };
+                    caller = std::move( caller).resume();
+                    return std::move( caller);
+                }};
+        f2.resume();
+        f2 = ctx::shared_fiber{};
+        BOOST_CHECK_EQUAL( 1, count);
+        // f1 was evicted, it is restored to be unwound
+    }
+    BOOST_CHECK_EQUAL( 2, count);
+}
+
+int main()
+{
+    test_interleaved();
+    test_stack_usage();
+    test_unwind();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,226 @@
+//          Copyright Oliver Kowalke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <boost/context/barrier.hpp>
+#include <boost/context/condition_variable.hpp>
+#include <boost/context/fiber.hpp>
+#include <boost/context/mutex.hpp>
+#include <boost/context/semaphore.hpp>
+#include <boost/context/this_fiber.hpp>
+
+#define BOOST_CHECK(x) BOOST_TEST(x)
+#define BOOST_CHECK_EQUAL(a, b) BOOST_TEST_EQ(a, b)
+
+namespace ctx = boost::context;
+
+// round-robin over the spawned fibers; a fiber parked by a primitive is
+// resumed by its notifier, yielding fibers are queued again
+class scheduler {
+private:
+    std::deque< ctx::fiber >    ready_{};
+
+public:
+    template< typename Fn >
+    void spawn( Fn fn) {
+        ready_.emplace_back( [fn]( ctx::fiber && sched) mutable {
+                    ctx::this_fiber::set_scheduler( std::move( sched) );
+                    fn();
+                    return ctx::this_fiber::release_scheduler();
+                });
+    }
+
+    void run() {
+        while ( ! ready_.empty() ) {
+            ctx::fiber f = std::move( ready_.front() );
+            ready_.pop_front();
+            f = std::move( f).resume();
+            if ( f) {
+                ready_.push_back( std::move( f) );
+            }
+        }
+    }
+};
+
+void test_mutex() {
+    ctx::mutex mtx;
+    scheduler s;
+    int inside = 0, count = 0;
+    bool exclusive = true;
+    std::vector< int > order;
+    for ( int i = 0; i < 3; ++i) {
+        s.spawn( [&,i](){
+                    for ( int j = 0; j < 3; ++j) {
+                        std::unique_lock< ctx::mutex > lk{ mtx };
+                        exclusive = exclusive && 0 == inside++;
+                        order.push_back( i);
+                        ctx::this_fiber::yield();
+                        BOOST_CHECK( ! mtx.try_lock() );
+                        --inside;
+                        ++count;
+                    }
+                });
+    }
+    s.run();
+    BOOST_CHECK( exclusive);
+    BOOST_CHECK_EQUAL( 9, count);
+    // ownership is handed over in FIFO order
+    BOOST_CHECK_EQUAL( 9u, order.size() );
+    for ( int k = 0; k < 3; ++k) {
+        BOOST_CHECK_EQUAL( k, order[k]);
+    }
+    BOOST_CHECK( mtx.try_lock() );
+    mtx.unlock();
+}
+
+void test_condition_variable() {
+    ctx::mutex mtx;
+    ctx::condition_variable cond;
+    scheduler s;
+    int value = 0, woken = 0;
+    for ( int i = 0; i < 3; ++i) {
+        s.spawn( [&](){
+                    std::unique_lock< ctx::mutex > lk{ mtx };
+                    cond.wait( lk, [&value](){ return 0 != value; });
+                    BOOST_CHECK( lk.owns_lock() );
+                    BOOST_CHECK_EQUAL( 42, value);
+                    ++woken;
+                });
+    }
+    s.spawn( [&](){
+                {
+                    std::unique_lock< ctx::mutex > lk{ mtx };
+                    value = 42;
+                }
+                cond.notify_one();
+                BOOST_CHECK_EQUAL( 1, woken);
+                cond.notify_all();
+                BOOST_CHECK_EQUAL( 3, woken);
+            });
+    s.run();
+    BOOST_CHECK_EQUAL( 3, woken);
+    // no waiter
+    cond.notify_one();
+    cond.notify_all();
+}
+
+void test_semaphore() {
+    ctx::semaphore sem;
+    scheduler s;
+    int acquired = 0;
+    for ( int i = 0; i < 3; ++i) {
+        s.spawn( [&](){
+                    sem.acquire();
+                    ++acquired;
+                });
+    }
+    s.run();
+    BOOST_CHECK_EQUAL( 0, acquired);
+    BOOST_CHECK( ! sem.try_acquire() );
+    // the permits are handed over to the waiters
+    sem.release( 2);
+    BOOST_CHECK_EQUAL( 2, acquired);
+    BOOST_CHECK( ! sem.try_acquire() );
+    sem.release( 2);
+    BOOST_CHECK_EQUAL( 3, acquired);
+    BOOST_CHECK( sem.try_acquire() );
+    BOOST_CHECK( ! sem.try_acquire() );
+}
+
+void test_barrier() {
+    {
+        ctx::barrier b{ 3 };
+        scheduler s;
+        int arrived = 0, last = 0;
+        bool synchronized = true;
+        for ( int i = 0; i < 3; ++i) {
+            s.spawn( [&](){
+                        for ( int gen = 1; gen <= 2; ++gen) {
+                            ++arrived;
+                            if ( b.wait() ) {
+                                ++last;
+                            }
+                            synchronized = synchronized && 3 * gen <= arrived;
+                        }
+                    });
+        }
+        s.run();
+        BOOST_CHECK( synchronized);
+        BOOST_CHECK_EQUAL( 6, arrived);
+        BOOST_CHECK_EQUAL( 2, last);
+    }
+    {
+        bool thrown = false;
+        try {
+            ctx::barrier b{ 0 };
+        } catch ( std::invalid_argument const&) {
+            thrown = true;
+        }
+        BOOST_CHECK( thrown);
+    }
+}
+
+void test_threads() {
+    // fibers migrate to the thread of their notifier,
+    // plain threads wait without scheduler
+    constexpr int threads = 4;
+    constexpr int increments = 1000;
+    ctx::mutex mtx;
+    ctx::semaphore sem{ 0 };
+    long counter = 0;
+    std::vector< std::thread > workers;
+    for ( int t = 0; t < threads; ++t) {
+        workers.emplace_back( [&](){
+                    scheduler s;
+                    for ( int i = 0; i < 2; ++i) {
+                        s.spawn( [&](){
+                                    for ( int j = 0; j < increments; ++j) {
+                                        std::unique_lock< ctx::mutex > lk{ mtx };
+                                        ++counter;
+                                        if ( 0 == j % 100) {
+                                            ctx::this_fiber::yield();
+                                        }
+                                    }
+                                    sem.release();
+                                });
+                    }
+                    s.run();
+                });
+    }
+    workers.emplace_back( [&](){
+                for ( int j = 0; j < increments; ++j) {
+                    std::unique_lock< ctx::mutex > lk{ mtx };
+                    ++counter;
+                }
+                for ( int i = 0; i < 2 * threads; ++i) {
+                    sem.acquire();
+                }
+            });
+    for ( std::thread & t : workers) {
+        t.join();
+    }
+    BOOST_CHECK_EQUAL( ( 2 * threads + 1) * increments, counter);
+}
+
+int main()
+{
+    test_mutex();
+    test_condition_variable();
+    test_semaphore();
+    test_barrier();
+    test_threads();
+
+    return boost::report_errors();
+}